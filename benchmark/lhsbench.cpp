@@ -0,0 +1,757 @@
+/**
+ * @file lhsbench.cpp
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Benchmarks of the lhslib, oalhslib, and oacpp engines, built without R.
+ *
+ * Each case is run a number of times from the same seed of
+ * CRandomStandardUniform, so every repetition does the same work and the
+ * results can be compared across versions.  The results are written as JSON
+ * with the time, the throughput in design elements per second, and the peak
+ * resident set size of each case.
+ *
+ * Usage: lhsbench [--quick] [--repeat N] [--filter TEXT] [--simd LEVEL] [--output FILE]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+#include "LHSCommonDefines.h"
+#include "simdDistance.h"
+#include "COrthogonalArray.h"
+#include "oaLHS.h"
+#include "lhslibVersion.h"
+#include "oalibVersion.h"
+#include "bclibVersion.h"
+
+namespace
+{
+    /** the seeds of the random number generator at the start of every repetition */
+    const unsigned int SEED1 = 1234;
+    const unsigned int SEED2 = 5678;
+
+    /**
+     * One benchmark case
+     */
+    struct BenchCase
+    {
+        std::string engine; /**< the function benchmarked */
+        std::vector<std::pair<std::string, std::string> > parameters; /**< the parameter names and JSON values */
+        double elements; /**< the number of design elements produced or checked by one run */
+        std::function<void()> run; /**< one run of the case */
+    };
+
+    /**
+     * The result of one benchmark case
+     */
+    struct BenchResult
+    {
+        double secondsMin; /**< the fastest repetition */
+        double secondsMedian; /**< the median repetition */
+        double secondsMean; /**< the mean repetition */
+        long long peakRssBytes; /**< the peak resident set size, -1 if unknown */
+        std::string error; /**< the error message if the case failed */
+    };
+
+    /**
+     * The command line options
+     */
+    struct BenchOptions
+    {
+        bool quick; /**< use the smaller sweeps */
+        int repeat; /**< the number of repetitions of each case */
+        std::string filter; /**< only run engines whose name contains this text */
+        std::string output; /**< the output file, standard output if empty */
+        std::string simd; /**< the instruction set of the distance kernels, detected if empty */
+    };
+
+    /**
+     * Format a parameter value as JSON
+     * @param value the value
+     * @return the JSON text
+     */
+    std::string jsonValue(int value)
+    {
+        std::ostringstream ss;
+        ss << value;
+        return ss.str();
+    }
+
+    /**
+     * Format a string as JSON
+     * @param value the string
+     * @return the quoted and escaped string
+     */
+    std::string jsonValue(const std::string & value)
+    {
+        std::string result = "\"";
+        for (size_t i = 0; i < value.size(); i++)
+        {
+            char c = value[i];
+            if (c == '"' || c == '\\')
+            {
+                result += '\\';
+                result += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char buffer[8];
+                std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(c));
+                result += buffer;
+            }
+            else
+            {
+                result += c;
+            }
+        }
+        return result + "\"";
+    }
+
+    /**
+     * Format a number as JSON
+     * @param value the number
+     * @return the JSON text, <code>null</code> if the number is not finite
+     */
+    std::string jsonNumber(double value)
+    {
+        if (!std::isfinite(value))
+        {
+            return "null";
+        }
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+        return buffer;
+    }
+
+    /**
+     * Reset the peak resident set size of the process so it can be measured for each case
+     * @return true if the peak was reset, which is only possible on Linux
+     */
+    bool resetPeakRss()
+    {
+#if defined(__linux__)
+        std::ofstream clearRefs("/proc/self/clear_refs");
+        if (!clearRefs)
+        {
+            return false;
+        }
+        clearRefs << "5";
+        clearRefs.flush();
+        return clearRefs.good();
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * The peak resident set size of the process
+     * @return the peak in bytes, since the last <code>resetPeakRss</code> on Linux, -1 if unknown
+     */
+    long long peakRssBytes()
+    {
+#if defined(__linux__)
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line))
+        {
+            if (line.compare(0, 6, "VmHWM:") == 0)
+            {
+                return std::atoll(line.c_str() + 6) * 1024LL;
+            }
+        }
+#endif
+#if defined(__APPLE__)
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+            return static_cast<long long>(usage.ru_maxrss);
+        }
+#elif defined(__unix__)
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+            return static_cast<long long>(usage.ru_maxrss) * 1024LL;
+        }
+#endif
+        return -1;
+    }
+
+    /**
+     * Run a case <code>repeat</code> times
+     * @param bc the case
+     * @param repeat the number of repetitions
+     * @return the timings and the peak resident set size
+     */
+    BenchResult runCase(const BenchCase & bc, int repeat)
+    {
+        BenchResult result;
+        result.secondsMin = result.secondsMedian = result.secondsMean = std::numeric_limits<double>::quiet_NaN();
+        result.peakRssBytes = -1;
+        std::vector<double> seconds;
+        resetPeakRss();
+        try
+        {
+            for (int i = 0; i < repeat; i++)
+            {
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                bc.run();
+                std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+                seconds.push_back(std::chrono::duration<double>(stop - start).count());
+            }
+        }
+        catch (std::exception & e)
+        {
+            result.error = e.what();
+            return result;
+        }
+        result.peakRssBytes = peakRssBytes();
+        std::sort(seconds.begin(), seconds.end());
+        result.secondsMin = seconds.front();
+        result.secondsMedian = (seconds.size() % 2 == 1) ? seconds[seconds.size() / 2] :
+            0.5 * (seconds[seconds.size() / 2 - 1] + seconds[seconds.size() / 2]);
+        result.secondsMean = std::accumulate(seconds.begin(), seconds.end(), 0.0) / static_cast<double>(seconds.size());
+        return result;
+    }
+
+    /**
+     * The benchmark cases of the Latin hypercube engines
+     * @param cases the list of cases to add to
+     * @param quick use the smaller sweeps
+     * @param oRandom the random number generator, reseeded before each run
+     */
+    void addLhsCases(std::vector<BenchCase> & cases, bool quick, bclib::CRandomStandardUniform & oRandom)
+    {
+        bclib::CRandomStandardUniform * rng = &oRandom;
+        std::vector<int> ks = {4, 10};
+
+        std::vector<int> randomNs = quick ? std::vector<int>{100, 1000} : std::vector<int>{100, 1000, 10000};
+        for (int n : randomNs)
+        {
+            for (int k : {4, 16})
+            {
+                BenchCase bc;
+                bc.engine = "randomLHS";
+                bc.parameters = {{"n", jsonValue(n)}, {"k", jsonValue(k)}};
+                bc.elements = static_cast<double>(n) * k;
+                bc.run = [n, k, rng]() {
+                    rng->setSeed(SEED1, SEED2);
+                    bclib::matrix<double> result(n, k);
+                    lhslib::randomLHS(n, k, false, result, *rng);
+                };
+                cases.push_back(bc);
+
+                bc.engine = "randomLHS_int";
+                bc.run = [n, k, rng]() {
+                    rng->setSeed(SEED1, SEED2);
+                    bclib::matrix<int> result(n, k);
+                    lhslib::randomLHS(n, k, result, *rng);
+                };
+                cases.push_back(bc);
+            }
+        }
+
+        std::vector<int> searchNs = quick ? std::vector<int>{50, 200} : std::vector<int>{50, 200, 1000};
+        for (int n : searchNs)
+        {
+            for (int k : ks)
+            {
+                for (int dup : {1, 5})
+                {
+                    BenchCase bc;
+                    bc.engine = "improvedLHS";
+                    bc.parameters = {{"n", jsonValue(n)}, {"k", jsonValue(k)}, {"dup", jsonValue(dup)}};
+                    bc.elements = static_cast<double>(n) * k;
+                    bc.run = [n, k, dup, rng]() {
+                        rng->setSeed(SEED1, SEED2);
+                        bclib::matrix<int> result(n, k);
+                        lhslib::improvedLHS(n, k, dup, result, *rng);
+                    };
+                    cases.push_back(bc);
+
+                    bc.engine = "maximinLHS";
+                    bc.run = [n, k, dup, rng]() {
+                        rng->setSeed(SEED1, SEED2);
+                        bclib::matrix<int> result(n, k);
+                        lhslib::maximinLHS(n, k, dup, result, *rng);
+                    };
+                    cases.push_back(bc);
+                }
+            }
+        }
+
+        std::vector<int> optimumNs = quick ? std::vector<int>{20, 50} : std::vector<int>{20, 50, 100};
+        const int maxSweeps = 2;
+        const double eps = 0.1;
+        for (int n : optimumNs)
+        {
+            for (int k : ks)
+            {
+                /* the length of the optimality record used by the R interface */
+                int jLen = n * (n - 1) / 2 + 1;
+                BenchCase bc;
+                bc.engine = "optimumLHS";
+                bc.parameters = {{"n", jsonValue(n)}, {"k", jsonValue(k)}, {"maxSweeps", jsonValue(maxSweeps)}};
+                bc.elements = static_cast<double>(n) * k;
+                bc.run = [n, k, jLen, eps, rng]() {
+                    rng->setSeed(SEED1, SEED2);
+                    bclib::matrix<int> result(n, k);
+                    lhslib::optimumLHS(n, k, maxSweeps, eps, result, jLen, *rng, false);
+                };
+                cases.push_back(bc);
+
+                /* the seed design is drawn once so that only the optimization is timed */
+                std::shared_ptr<bclib::matrix<double> > seed = std::make_shared<bclib::matrix<double> >(n, k);
+                rng->setSeed(SEED1, SEED2);
+                lhslib::randomLHS(n, k, false, *seed, *rng);
+                bc.engine = "optSeededLHS";
+                bc.run = [n, k, jLen, eps, seed]() {
+                    bclib::matrix<double> result = *seed;
+                    lhslib::optSeededLHS(n, k, maxSweeps, eps, result, jLen, false);
+                };
+                cases.push_back(bc);
+            }
+        }
+
+        std::vector<int> geneticNs = quick ? std::vector<int>{20} : std::vector<int>{20, 100};
+        std::vector<int> pops = quick ? std::vector<int>{10} : std::vector<int>{10, 50};
+        const int gen = 4;
+        const double pMut = 0.1;
+        for (int n : geneticNs)
+        {
+            for (int k : ks)
+            {
+                for (int pop : pops)
+                {
+                    for (const char * criterium : {"S", "Maximin"})
+                    {
+                        std::string crit = criterium;
+                        BenchCase bc;
+                        bc.engine = "geneticLHS";
+                        bc.parameters = {{"n", jsonValue(n)}, {"k", jsonValue(k)}, {"pop", jsonValue(pop)},
+                            {"gen", jsonValue(gen)}, {"criterium", jsonValue(crit)}};
+                        bc.elements = static_cast<double>(n) * k;
+                        bc.run = [n, k, pop, pMut, crit, rng]() {
+                            rng->setSeed(SEED1, SEED2);
+                            bclib::matrix<double> result(n, k);
+                            lhslib::geneticLHS(n, k, pop, gen, pMut, crit, false, result, *rng);
+                        };
+                        cases.push_back(bc);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * The benchmark cases of the orthogonal array Latin hypercubes
+     * @param cases the list of cases to add to
+     * @param quick use the smaller sweeps
+     * @param oRandom the random number generator, reseeded before each run
+     */
+    void addOaLhsCases(std::vector<BenchCase> & cases, bool quick, bclib::CRandomStandardUniform & oRandom)
+    {
+        bclib::CRandomStandardUniform * rng = &oRandom;
+
+        std::vector<int> qs = quick ? std::vector<int>{5, 11} : std::vector<int>{5, 11, 31};
+        for (int q : qs)
+        {
+            for (int k : {3, 6})
+            {
+                /* the orthogonal array is built once so that only the Latin hypercube is timed */
+                std::shared_ptr<oacpp::COrthogonalArray> oa = std::make_shared<oacpp::COrthogonalArray>();
+                int n = 0;
+                oa->bose(q, k, &n);
+                BenchCase bc;
+                bc.engine = "oaLHS";
+                bc.parameters = {{"q", jsonValue(q)}, {"n", jsonValue(n)}, {"k", jsonValue(k)}};
+                bc.elements = static_cast<double>(n) * k;
+                bc.run = [n, k, oa, rng]() {
+                    rng->setSeed(SEED1, SEED2);
+                    bclib::matrix<int> intlhs(n, k);
+                    bclib::matrix<double> lhs(n, k);
+                    oalhslib::oaLHS(n, k, oa->getoa(), intlhs, lhs, false, *rng);
+                };
+                cases.push_back(bc);
+            }
+        }
+
+        std::vector<int> ns = quick ? std::vector<int>{25, 100} : std::vector<int>{25, 100, 1000};
+        for (int n : ns)
+        {
+            for (int k : {3, 6})
+            {
+                BenchCase bc;
+                bc.engine = "generateOALHS";
+                bc.parameters = {{"n", jsonValue(n)}, {"k", jsonValue(k)}};
+                bc.elements = static_cast<double>(n) * k;
+                bc.run = [n, k, rng]() {
+                    rng->setSeed(SEED1, SEED2);
+                    bclib::matrix<double> oalhs;
+                    oalhslib::generateOALHS(n, k, oalhs, true, false, *rng);
+                };
+                cases.push_back(bc);
+            }
+        }
+    }
+
+    /**
+     * Add a case that constructs an orthogonal array
+     * @param cases the list of cases to add to
+     * @param engine the name of the construction
+     * @param parameters the parameter names and JSON values
+     * @param rows the number of rows of the array
+     * @param k the number of columns of the array
+     * @param construct the construction
+     */
+    void addConstructionCase(std::vector<BenchCase> & cases, const std::string & engine,
+        const std::vector<std::pair<std::string, std::string> > & parameters, int rows, int k,
+        const std::function<void(oacpp::COrthogonalArray &, int *)> & construct)
+    {
+        BenchCase bc;
+        bc.engine = engine;
+        bc.parameters = parameters;
+        bc.parameters.push_back(std::make_pair(std::string("n"), jsonValue(rows)));
+        bc.elements = static_cast<double>(rows) * k;
+        bc.run = [construct]() {
+            oacpp::COrthogonalArray oa;
+            int n = 0;
+            construct(oa, &n);
+        };
+        cases.push_back(bc);
+    }
+
+    /**
+     * The benchmark cases of the orthogonal array constructions
+     * @param cases the list of cases to add to
+     * @param quick use the smaller sweeps
+     */
+    void addOaConstructionCases(std::vector<BenchCase> & cases, bool quick)
+    {
+        /* addelkemp needs an odd prime power q and k <= 2q+1 */
+        for (int q : quick ? std::vector<int>{3, 5} : std::vector<int>{3, 5, 7, 9})
+        {
+            int k = 2 * q;
+            addConstructionCase(cases, "addelkemp", {{"q", jsonValue(q)}, {"k", jsonValue(k)}}, 2 * q * q, k,
+                [q, k](oacpp::COrthogonalArray & oa, int * n) {oa.addelkemp(q, k, n);});
+        }
+        /* addelkemp3 needs a prime power q and k <= 2q^2+2q+1 */
+        for (int q : quick ? std::vector<int>{2, 3} : std::vector<int>{2, 3, 4, 5})
+        {
+            int k = 2 * q * q;
+            addConstructionCase(cases, "addelkemp3", {{"q", jsonValue(q)}, {"k", jsonValue(k)}}, 2 * q * q * q, k,
+                [q, k](oacpp::COrthogonalArray & oa, int * n) {oa.addelkemp3(q, k, n);});
+        }
+        /* addelkempn needs a prime power q and k <= 2(q^akn-1)/(q-1)-1 */
+        for (int q : quick ? std::vector<int>{3} : std::vector<int>{3, 5})
+        {
+            for (int akn : {2, 3})
+            {
+                int qn = 1;
+                for (int i = 0; i < akn; i++)
+                {
+                    qn *= q;
+                }
+                int k = 2 * (qn - 1) / (q - 1) - 1;
+                addConstructionCase(cases, "addelkempn", {{"akn", jsonValue(akn)}, {"q", jsonValue(q)}, {"k", jsonValue(k)}},
+                    2 * qn, k, [akn, q, k](oacpp::COrthogonalArray & oa, int * n) {oa.addelkempn(akn, q, k, n);});
+            }
+        }
+        /* bose needs a prime power q and k <= q+1 */
+        for (int q : quick ? std::vector<int>{5, 11} : std::vector<int>{5, 11, 16, 31, 64})
+        {
+            int k = q + 1;
+            addConstructionCase(cases, "bose", {{"q", jsonValue(q)}, {"k", jsonValue(k)}}, q * q, k,
+                [q, k](oacpp::COrthogonalArray & oa, int * n) {oa.bose(q, k, n);});
+        }
+        /* bosebush needs a power of 2 q and k <= 2q+1 */
+        for (int q : quick ? std::vector<int>{2, 4} : std::vector<int>{2, 4, 8, 16})
+        {
+            int k = 2 * q;
+            addConstructionCase(cases, "bosebush", {{"q", jsonValue(q)}, {"k", jsonValue(k)}}, 2 * q * q, k,
+                [q, k](oacpp::COrthogonalArray & oa, int * n) {oa.bosebush(q, k, n);});
+        }
+        /* bosebushl needs q and lambda to be powers of the same prime and k <= lambda*q+1 */
+        for (int q : quick ? std::vector<int>{3} : std::vector<int>{3, 4, 9})
+        {
+            int lambda = (q == 4) ? 2 : 3;
+            int k = lambda * q;
+            addConstructionCase(cases, "bosebushl", {{"lambda", jsonValue(lambda)}, {"q", jsonValue(q)}, {"k", jsonValue(k)}},
+                lambda * q * q, k, [lambda, q, k](oacpp::COrthogonalArray & oa, int * n) {oa.bosebushl(lambda, q, k, n);});
+        }
+        /* bush needs a prime power q and k <= q+1 */
+        for (int q : quick ? std::vector<int>{3, 5} : std::vector<int>{3, 5, 8, 13})
+        {
+            int k = q + 1;
+            addConstructionCase(cases, "bush", {{"q", jsonValue(q)}, {"k", jsonValue(k)}}, q * q * q, k,
+                [q, k](oacpp::COrthogonalArray & oa, int * n) {oa.bush(q, k, n);});
+        }
+        /* busht needs a prime power q, k <= q+1, and strength 3 or more */
+        for (int q : quick ? std::vector<int>{3} : std::vector<int>{3, 5, 7})
+        {
+            for (int str : {3, 4})
+            {
+                int k = q + 1;
+                int rows = 1;
+                for (int i = 0; i < str; i++)
+                {
+                    rows *= q;
+                }
+                addConstructionCase(cases, "busht", {{"str", jsonValue(str)}, {"q", jsonValue(q)}, {"k", jsonValue(k)}},
+                    rows, k, [str, q, k](oacpp::COrthogonalArray & oa, int * n) {oa.busht(str, q, k, n);});
+            }
+        }
+    }
+
+    /**
+     * The benchmark cases of the orthogonal array strength checkers
+     * @param cases the list of cases to add to
+     * @param quick use the smaller sweeps
+     */
+    void addOaCheckerCases(std::vector<BenchCase> & cases, bool quick)
+    {
+        /* strength 2 arrays from bose and strength 3 arrays from bush, checked at their strength by oastrt */
+        std::vector<std::pair<std::string, int> > arrays = quick ?
+            std::vector<std::pair<std::string, int> >{{"bose", 5}, {"bush", 3}} :
+            std::vector<std::pair<std::string, int> >{{"bose", 5}, {"bose", 11}, {"bose", 16}, {"bush", 3}, {"bush", 5}};
+        for (size_t i = 0; i < arrays.size(); i++)
+        {
+            const std::string & construction = arrays[i].first;
+            int q = arrays[i].second;
+            int k = q + 1;
+            int n = 0;
+            int strength = (construction == "bose") ? 2 : 3;
+            std::shared_ptr<oacpp::COrthogonalArray> oa = std::make_shared<oacpp::COrthogonalArray>();
+            if (construction == "bose")
+            {
+                oa->bose(q, k, &n);
+            }
+            else
+            {
+                oa->bush(q, k, &n);
+            }
+            std::vector<std::pair<std::string, std::string> > parameters =
+                {{"array", jsonValue(construction)}, {"q", jsonValue(q)}, {"n", jsonValue(n)}, {"k", jsonValue(k)},
+                 {"strength", jsonValue(strength)}};
+            double elements = static_cast<double>(n) * k;
+
+            std::vector<std::pair<std::string, std::function<void()> > > checkers = {
+                {"oastr", [oa]() {oa->oastr(false);}},
+                {"oastr1", [oa]() {oa->oastr1(false);}},
+                {"oastr2", [oa]() {oa->oastr2(false);}},
+                {"oastr3", [oa]() {oa->oastr3(false);}},
+                {"oastr4", [oa]() {oa->oastr4(false);}},
+                {"oastrt", [oa, strength]() {oa->oastrt(strength, false);}},
+                {"oastrt_sampled", [oa, strength]() {
+                    double bound = 0.0;
+                    oa->oastrt_sampled(strength, 200, 0.95, &bound, false);
+                }}
+            };
+            for (size_t j = 0; j < checkers.size(); j++)
+            {
+                BenchCase bc;
+                bc.engine = checkers[j].first;
+                bc.parameters = parameters;
+                bc.elements = elements;
+                bc.run = checkers[j].second;
+                cases.push_back(bc);
+            }
+        }
+    }
+
+    /**
+     * Parse the command line
+     * @param argc the number of arguments
+     * @param argv the arguments
+     * @return the options
+     * @throws std::runtime_error for an unknown or incomplete option
+     */
+    BenchOptions parseOptions(int argc, char ** argv)
+    {
+        BenchOptions options;
+        options.quick = false;
+        options.repeat = 3;
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--quick")
+            {
+                options.quick = true;
+            }
+            else if ((arg == "--repeat" || arg == "--filter" || arg == "--output" || arg == "--simd") && i + 1 < argc)
+            {
+                std::string value = argv[++i];
+                if (arg == "--repeat")
+                {
+                    options.repeat = std::atoi(value.c_str());
+                    if (options.repeat < 1)
+                    {
+                        throw std::runtime_error("--repeat must be a positive integer");
+                    }
+                }
+                else if (arg == "--filter")
+                {
+                    options.filter = value;
+                }
+                else if (arg == "--output")
+                {
+                    options.output = value;
+                }
+                else
+                {
+                    options.simd = value;
+                }
+            }
+            else
+            {
+                throw std::runtime_error("usage: lhsbench [--quick] [--repeat N] [--filter TEXT] [--simd scalar|sse4.1|avx2|avx512] [--output FILE]");
+            }
+        }
+        return options;
+    }
+
+    /**
+     * Choose the instruction set of the distance kernels by name
+     * @param name the name from <code>simdLevelName</code>
+     * @throws std::runtime_error if the name is unknown
+     */
+    void chooseSimdLevel(const std::string & name)
+    {
+        const lhslib::SimdLevel levels[] = {lhslib::SIMD_SCALAR, lhslib::SIMD_SSE41, lhslib::SIMD_AVX2, lhslib::SIMD_AVX512};
+        for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+        {
+            if (name == lhslib::simdLevelName(levels[i]))
+            {
+                lhslib::setSimdLevel(levels[i]);
+                return;
+            }
+        }
+        throw std::runtime_error("unknown --simd level " + name);
+    }
+} // end namespace
+
+int main(int argc, char ** argv)
+{
+    BenchOptions options;
+    try
+    {
+        options = parseOptions(argc, argv);
+        if (!options.simd.empty())
+        {
+            chooseSimdLevel(options.simd);
+        }
+    }
+    catch (std::exception & e)
+    {
+        std::cerr << e.what() << "\n";
+        return 2;
+    }
+
+    bclib::CRandomStandardUniform oRandom;
+    std::vector<BenchCase> allCases;
+    addLhsCases(allCases, options.quick, oRandom);
+    addOaLhsCases(allCases, options.quick, oRandom);
+    addOaConstructionCases(allCases, options.quick);
+    addOaCheckerCases(allCases, options.quick);
+
+    std::vector<BenchCase> cases;
+    for (size_t i = 0; i < allCases.size(); i++)
+    {
+        if (allCases[i].engine.find(options.filter) != std::string::npos)
+        {
+            cases.push_back(allCases[i]);
+        }
+    }
+
+    bool bCaseRss = resetPeakRss();
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"benchmark\": \"lhsbench\",\n";
+    json << "  \"versions\": {\"lhslib\": " << jsonValue(lhslib::getVersion())
+         << ", \"oalib\": " << jsonValue(oacpp::getVersion())
+         << ", \"bclib\": " << jsonValue(bclib::getVersion()) << "},\n";
+    json << "  \"simd\": " << jsonValue(lhslib::simdLevelName(lhslib::getSimdLevel())) << ",\n";
+    json << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+    json << "  \"repeat\": " << options.repeat << ",\n";
+    json << "  \"seed\": [" << SEED1 << ", " << SEED2 << "],\n";
+    json << "  \"peak_rss_scope\": " << jsonValue(std::string(bCaseRss ? "case" : "process")) << ",\n";
+    json << "  \"results\": [";
+    int failures = 0;
+    for (size_t i = 0; i < cases.size(); i++)
+    {
+        const BenchCase & bc = cases[i];
+        std::cerr << "lhsbench: " << bc.engine << " (" << i + 1 << "/" << cases.size() << ")\n";
+        BenchResult result = runCase(bc, options.repeat);
+        json << (i == 0 ? "\n" : ",\n");
+        json << "    {\"engine\": " << jsonValue(bc.engine) << ", \"parameters\": {";
+        for (size_t j = 0; j < bc.parameters.size(); j++)
+        {
+            json << (j == 0 ? "" : ", ") << jsonValue(bc.parameters[j].first) << ": " << bc.parameters[j].second;
+        }
+        json << "}, ";
+        if (!result.error.empty())
+        {
+            failures++;
+            json << "\"error\": " << jsonValue(result.error) << "}";
+            continue;
+        }
+        json << "\"seconds_min\": " << jsonNumber(result.secondsMin)
+             << ", \"seconds_median\": " << jsonNumber(result.secondsMedian)
+             << ", \"seconds_mean\": " << jsonNumber(result.secondsMean)
+             << ", \"throughput\": " << jsonNumber(bc.elements / result.secondsMin)
+             << ", \"throughput_unit\": \"elements/s\""
+             << ", \"peak_rss_bytes\": " << (result.peakRssBytes < 0 ? std::string("null") : std::to_string(result.peakRssBytes))
+             << "}";
+    }
+    json << "\n  ]\n}\n";
+
+    if (options.output.empty())
+    {
+        std::cout << json.str();
+    }
+    else
+    {
+        std::ofstream out(options.output.c_str());
+        if (!out)
+        {
+            std::cerr << "lhsbench: cannot open " << options.output << "\n";
+            return 2;
+        }
+        out << json.str();
+    }
+    return (failures == 0) ? 0 : 1;
+}
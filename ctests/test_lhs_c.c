@@ -0,0 +1,340 @@
+/**
+ * @file test_lhs_c.c
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Tests of the C interface in lhs_c.h: the status codes, the message of the
+ * last error, and the buffer size negotiation.  Written in C89 so that the
+ * header is checked with a C compiler.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "lhs_c.h"
+
+static int failures = 0;
+
+#define CHECK(cond) check((cond) != 0, #cond, __LINE__)
+
+static void check(int ok, const char * expr, int line)
+{
+    if (!ok)
+    {
+        printf("FAILED line %d: %s\n", line, expr);
+        failures++;
+    }
+}
+
+/** Marsaglia's multiply with carry generator and a count of the draws */
+typedef struct multicarry
+{
+    unsigned int i1;
+    unsigned int i2;
+    long draws;
+} multicarry;
+
+static double nextUniform(void * state)
+{
+    multicarry * m = (multicarry *) state;
+    m->draws++;
+    m->i1 = 36969 * (m->i1 & 0177777) + (m->i1 >> 16);
+    m->i2 = 18000 * (m->i2 & 0177777) + (m->i2 >> 16);
+    return (((m->i1 << 16) ^ (m->i2 & 0177777)) + 0.5) * 2.328306437080797e-10;
+}
+
+/* each column of an n x k design by column has exactly one value in each of the n strata */
+static int isLatinHypercube(const double * design, int n, int k)
+{
+    int i, j;
+    int * seen = (int *) calloc((size_t) n, sizeof(int));
+    int ok = 1;
+    for (j = 0; j < k && ok; j++)
+    {
+        memset(seen, 0, (size_t) n * sizeof(int));
+        for (i = 0; i < n; i++)
+        {
+            double v = design[i + j * n];
+            int stratum = (int) (v * n);
+            if (v <= 0.0 || v >= 1.0 || seen[stratum])
+            {
+                ok = 0;
+                break;
+            }
+            seen[stratum] = 1;
+        }
+    }
+    free(seen);
+    return ok;
+}
+
+static void testVersion(void)
+{
+    CHECK(lhs_api_version() == LHS_C_API_VERSION);
+    CHECK(lhs_version() != NULL && strlen(lhs_version()) > 0);
+}
+
+static void testDesigns(void)
+{
+    multicarry state = {1234, 5678, 0};
+    lhs_rng rng;
+    double design[20 * 4];
+    rng.uniform = nextUniform;
+    rng.state = &state;
+
+    CHECK(lhs_random(20, 4, 0, &rng, design) == LHS_OK);
+    CHECK(isLatinHypercube(design, 20, 4));
+    CHECK(lhs_improved(20, 4, 3, &rng, design) == LHS_OK);
+    CHECK(isLatinHypercube(design, 20, 4));
+    CHECK(lhs_maximin(20, 4, 3, &rng, design) == LHS_OK);
+    CHECK(isLatinHypercube(design, 20, 4));
+    CHECK(lhs_optimum(20, 4, 2, 0.1, 0, &rng, design) == LHS_OK);
+    CHECK(isLatinHypercube(design, 20, 4));
+    CHECK(lhs_optimum_seeded(20, 4, 2, 0.1, 0, design) == LHS_OK);
+    CHECK(isLatinHypercube(design, 20, 4));
+    CHECK(lhs_genetic(20, 4, 10, 4, 0.1, "S", 0, &rng, design) == LHS_OK);
+    CHECK(isLatinHypercube(design, 20, 4));
+    CHECK(lhs_genetic(20, 4, 10, 4, 0.1, "Maximin", 0, &rng, design) == LHS_OK);
+    CHECK(isLatinHypercube(design, 20, 4));
+    CHECK(lhs_improved(1, 4, 3, &rng, design) == LHS_OK);
+    CHECK(isLatinHypercube(design, 1, 4));
+}
+
+static void testArgumentErrors(void)
+{
+    multicarry state = {1234, 5678, 0};
+    lhs_rng rng;
+    lhs_rng nullCallback;
+    double design[20 * 4];
+    int oa[100];
+    int rows = 0;
+    int cols = 0;
+    rng.uniform = nextUniform;
+    rng.state = &state;
+    nullCallback.uniform = NULL;
+    nullCallback.state = NULL;
+
+    CHECK(lhs_random(0, 4, 0, &rng, design) == LHS_ERROR_ARGUMENT);
+    CHECK(strlen(lhs_last_error()) > 0);
+    CHECK(lhs_random(20, 0, 0, &rng, design) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_random(20, 4, 0, &rng, NULL) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_random(20, 4, 0, NULL, design) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_random(20, 4, 0, &nullCallback, design) == LHS_ERROR_ARGUMENT);
+    CHECK(strstr(lhs_last_error(), "uniform callback") != NULL);
+
+    CHECK(lhs_improved(20, 4, 0, &rng, design) == LHS_ERROR_ARGUMENT);
+    CHECK(strstr(lhs_last_error(), "dup") != NULL);
+    CHECK(lhs_maximin(20, 4, 0, &rng, design) == LHS_ERROR_ARGUMENT);
+
+    CHECK(lhs_optimum(20, 4, 0, 0.1, 0, &rng, design) == LHS_ERROR_ARGUMENT);
+    CHECK(strstr(lhs_last_error(), "max_sweeps") != NULL);
+    CHECK(lhs_optimum(20, 4, 2, 0.0, 0, &rng, design) == LHS_ERROR_ARGUMENT);
+    CHECK(strstr(lhs_last_error(), "eps") != NULL);
+    CHECK(lhs_optimum(20, 4, 2, 1.0, 0, &rng, design) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_optimum_seeded(20, 4, 0, 0.1, 0, design) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_optimum_seeded(20, 4, 2, -0.1, 0, design) == LHS_ERROR_ARGUMENT);
+
+    CHECK(lhs_genetic(20, 4, 9, 4, 0.1, "S", 0, &rng, design) == LHS_ERROR_ARGUMENT);
+    CHECK(strstr(lhs_last_error(), "even") != NULL);
+    CHECK(lhs_genetic(20, 4, 10, 0, 0.1, "S", 0, &rng, design) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_genetic(20, 4, 10, 4, 1.5, "S", 0, &rng, design) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_genetic(20, 4, 10, 4, 0.1, "X", 0, &rng, design) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_genetic(20, 4, 10, 4, 0.1, NULL, 0, &rng, design) == LHS_ERROR_ARGUMENT);
+
+    CHECK(lhs_create_oa(LHS_OA_BOSE, 6, 4, 0, oa, 100, &rows) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_create_oa(LHS_OA_BOSE, 3, 5, 0, oa, 100, &rows) == LHS_ERROR_ARGUMENT);
+    CHECK(strstr(lhs_last_error(), "columns") != NULL);
+    CHECK(lhs_create_oa(LHS_OA_BOSEBUSH, 3, 4, 0, oa, 100, &rows) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_create_oa((lhs_oa_type) 99, 3, 4, 0, oa, 100, &rows) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_create_oa(LHS_OA_BOSE, 3, 4, 0, NULL, 100, &rows) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_create_oa(LHS_OA_BOSE, 3, 4, 0, oa, 100, NULL) == LHS_ERROR_ARGUMENT);
+
+    CHECK(lhs_oa_to_lhs(9, 4, NULL, 0, &rng, design) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_oalhs_size(0, 3, 1, &rows, &cols) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_oalhs_size(20, 3, 1, NULL, &cols) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_create_oalhs(20, 0, 1, 0, &rng, design, 80) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_create_oalhs(20, 3, 1, 0, &rng, NULL, 80) == LHS_ERROR_ARGUMENT);
+}
+
+static void testBuffers(void)
+{
+    multicarry state = {1234, 5678, 0};
+    lhs_rng rng;
+    int small[10];
+    int * oa;
+    double * design;
+    double * converted;
+    int rows = 0;
+    int cols = 0;
+    long draws;
+    rng.uniform = nextUniform;
+    rng.state = &state;
+
+    /* a small buffer reports the number of rows so that the call can be repeated */
+    CHECK(lhs_create_oa(LHS_OA_BOSE, 3, 4, 0, small, 10, &rows) == LHS_ERROR_BUFFER);
+    CHECK(rows == 9);
+    CHECK(strstr(lhs_last_error(), "too small") != NULL);
+    oa = (int *) malloc((size_t) rows * 4 * sizeof(int));
+    CHECK(lhs_create_oa(LHS_OA_BOSE, 3, 4, 0, oa, (size_t) rows * 4, &rows) == LHS_OK);
+    CHECK(rows == 9);
+    converted = (double *) malloc((size_t) rows * 4 * sizeof(double));
+    CHECK(lhs_oa_to_lhs(rows, 4, oa, 0, &rng, converted) == LHS_OK);
+    CHECK(isLatinHypercube(converted, rows, 4));
+    free(converted);
+    free(oa);
+
+    /* the size is known before the design is drawn, and a small buffer draws nothing */
+    CHECK(lhs_oalhs_size(20, 3, 1, &rows, &cols) == LHS_OK);
+    CHECK(rows >= 20 && cols == 3);
+    design = (double *) malloc((size_t) rows * cols * sizeof(double));
+    draws = state.draws;
+    CHECK(lhs_create_oalhs(20, 3, 1, 0, &rng, design, 3) == LHS_ERROR_BUFFER);
+    CHECK(state.draws == draws);
+    CHECK(lhs_create_oalhs(20, 3, 1, 0, &rng, design, (size_t) rows * cols) == LHS_OK);
+    CHECK(state.draws > draws);
+    CHECK(isLatinHypercube(design, rows, cols));
+    free(design);
+}
+
+static void testStatistics(void)
+{
+    multicarry state = {1234, 5678, 0};
+    lhs_rng rng;
+    double design[20 * 4];
+    double trajectory[4];
+    lhs_statistics * stats = lhs_statistics_create();
+    size_t length;
+    size_t i;
+    int found = 0;
+    rng.uniform = nextUniform;
+    rng.state = &state;
+
+    CHECK(stats != NULL);
+    CHECK(lhs_set_statistics(stats) == NULL);
+    CHECK(lhs_optimum(20, 4, 2, 0.1, 0, &rng, design) == LHS_OK);
+    CHECK(lhs_set_statistics(NULL) == stats);
+
+    CHECK(lhs_statistics_count(stats, LHS_STAT_CRITERION_EVALUATIONS) > 0);
+    CHECK(lhs_statistics_count(stats, LHS_STAT_RANDOM_DRAWS) == (double) state.draws);
+    CHECK(lhs_statistics_count(stats, (lhs_statistic) 99) == -1.0);
+    CHECK(lhs_statistics_count(NULL, LHS_STAT_ACCEPTED_MOVES) == -1.0);
+
+    length = lhs_statistics_trajectory(stats, NULL, 0);
+    CHECK(length > 0);
+    CHECK(lhs_statistics_trajectory(stats, trajectory, 4) == length);
+
+    for (i = 0; i < lhs_statistics_phases(stats); i++)
+    {
+        if (strcmp(lhs_statistics_phase_name(stats, i), "optimize") == 0)
+        {
+            found = 1;
+            CHECK(lhs_statistics_phase_seconds(stats, i) >= 0.0);
+        }
+    }
+    CHECK(found);
+    CHECK(lhs_statistics_phase_name(stats, 100) == NULL);
+    CHECK(lhs_statistics_phase_seconds(stats, 100) == -1.0);
+
+    /* freeing an attached collector detaches it */
+    CHECK(lhs_set_statistics(stats) == NULL);
+    lhs_statistics_free(stats);
+    CHECK(lhs_set_statistics(NULL) == NULL);
+}
+
+static void testThreads(void)
+{
+    int * serial = (int *) malloc(101 * 101 * 4 * sizeof(int));
+    int * parallel = (int *) malloc(101 * 101 * 4 * sizeof(int));
+    int rows = 0;
+
+    CHECK(lhs_get_max_threads() >= 1);
+    CHECK(lhs_set_max_threads(-1) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_set_max_threads(1) == LHS_OK);
+    CHECK(lhs_get_max_threads() == 1);
+    CHECK(lhs_create_oa(LHS_OA_BOSE, 101, 4, 0, serial, 101 * 101 * 4, &rows) == LHS_OK);
+    CHECK(lhs_set_max_threads(3) == LHS_OK);
+    CHECK(lhs_get_max_threads() == 3);
+    CHECK(lhs_create_oa(LHS_OA_BOSE, 101, 4, 0, parallel, 101 * 101 * 4, &rows) == LHS_OK);
+    CHECK(memcmp(serial, parallel, 101 * 101 * 4 * sizeof(int)) == 0);
+    CHECK(lhs_set_max_threads(0) == LHS_OK);
+    CHECK(lhs_get_max_threads() >= 1);
+    free(serial);
+    free(parallel);
+}
+
+static void testSampledStrength(void)
+{
+    int oa[11 * 11 * 12];
+    int rows = 0;
+    int passed = -1;
+    double bound = -1.0;
+    multicarry m = {1234u, 5678u, 0};
+    lhs_rng rng;
+    rng.uniform = nextUniform;
+    rng.state = &m;
+
+    /* the 15 column pairs fit in the default sample, so every pair is checked */
+    CHECK(lhs_create_oa(LHS_OA_BOSE, 5, 6, 0, oa, sizeof(oa) / sizeof(int), &rows) == LHS_OK);
+    CHECK(lhs_check_oa_strength_sampled(rows, 6, 5, oa, 2, 0, 0.95, &rng, &passed, &bound) == LHS_OK);
+    CHECK(passed == 1 && bound == 0.0 && m.draws == 0);
+    /* an array cannot have a strength larger than its construction */
+    CHECK(lhs_check_oa_strength_sampled(rows, 6, 5, oa, 3, 0, 0.95, &rng, &passed, &bound) == LHS_OK);
+    CHECK(passed == 0 && bound == 1.0);
+    /* a perturbed value breaks the balance of the pairs with its column */
+    oa[0] = (oa[0] + 1) % 5;
+    CHECK(lhs_check_oa_strength_sampled(rows, 6, 5, oa, 2, 0, 0.95, &rng, &passed, &bound) == LHS_OK);
+    CHECK(passed == 0 && bound == 1.0);
+
+    /* 66 column pairs are more than 10 samples of t = 2 columns each */
+    CHECK(lhs_create_oa(LHS_OA_BOSE, 11, 12, 0, oa, sizeof(oa) / sizeof(int), &rows) == LHS_OK);
+    CHECK(lhs_check_oa_strength_sampled(rows, 12, 11, oa, 2, 10, 0.95, &rng, &passed, &bound) == LHS_OK);
+    CHECK(passed == 1);
+    CHECK(fabs(bound - (1.0 - pow(1.0 - 0.95, 1.0 / 10.0))) < 1e-12);
+    CHECK(m.draws == 10 * 2);
+
+    CHECK(lhs_check_oa_strength_sampled(rows, 12, 11, NULL, 2, 10, 0.95, &rng, &passed, &bound) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_check_oa_strength_sampled(rows, 12, 11, oa, 2, 10, 0.95, NULL, &passed, &bound) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_check_oa_strength_sampled(rows, 12, 11, oa, 0, 10, 0.95, &rng, &passed, &bound) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_check_oa_strength_sampled(rows, 12, 11, oa, 13, 10, 0.95, &rng, &passed, &bound) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_check_oa_strength_sampled(rows, 12, 11, oa, 2, -1, 0.95, &rng, &passed, &bound) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_check_oa_strength_sampled(rows, 12, 11, oa, 2, 10, 1.0, &rng, &passed, &bound) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_check_oa_strength_sampled(rows, 12, 1, oa, 2, 10, 0.95, &rng, &passed, &bound) == LHS_ERROR_ARGUMENT);
+    CHECK(lhs_check_oa_strength_sampled(rows, 12, 5, oa, 2, 10, 0.95, &rng, &passed, &bound) == LHS_ERROR_ARGUMENT);
+    CHECK(strlen(lhs_last_error()) > 0);
+}
+
+int main(void)
+{
+    CHECK(strlen(lhs_last_error()) == 0);
+    testVersion();
+    testDesigns();
+    testArgumentErrors();
+    testBuffers();
+    testStatistics();
+    testThreads();
+    testSampledStrength();
+    if (failures > 0)
+    {
+        printf("%d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file test_lhslib.cpp
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Tests of the C++ interface of lhslib that the C interface does not reach:
+ * results in either matrix layout.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include "LHSCommonDefines.h"
+#include "utilityLHS.h"
+
+static int failures = 0;
+
+#define CHECK(cond) check((cond), #cond, __LINE__)
+
+static void check(bool ok, const char * expr, int line)
+{
+    if (!ok)
+    {
+        std::printf("FAILED line %d: %s\n", line, expr);
+        failures++;
+    }
+}
+
+static bool sameDesign(const bclib::matrix<int> & A, const bclib::matrix<int> & B)
+{
+    if (A.rowsize() != B.rowsize() || A.colsize() != B.colsize())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < A.rowsize(); i++)
+    {
+        for (size_t j = 0; j < A.colsize(); j++)
+        {
+            if (A(i, j) != B(i, j))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* an n x k result with contiguous columns */
+static bclib::matrix<int> transposedResult(int n, int k)
+{
+    bclib::matrix<int> result(static_cast<size_t>(k), static_cast<size_t>(n));
+    result.transpose();
+    return result;
+}
+
+typedef void (*lhsAlgorithm)(int, int, int, bclib::matrix<int> &, bclib::CRandom<double> &);
+
+static void testTransposedResult(lhsAlgorithm algorithm, int n, int k, int dup)
+{
+    bclib::CRandomStandardUniform oRandom;
+    bclib::matrix<int> rowMajor(static_cast<size_t>(n), static_cast<size_t>(k));
+    algorithm(n, k, dup, rowMajor, oRandom);
+
+    bclib::matrix<int> columnMajor = transposedResult(n, k);
+    CHECK(columnMajor.isTransposed());
+    CHECK(columnMajor.rowsize() == static_cast<size_t>(n));
+    oRandom.setSeed(1234, 5678);
+    algorithm(n, k, dup, columnMajor, oRandom);
+    CHECK(lhslib::isValidLHS(columnMajor));
+    CHECK(sameDesign(rowMajor, columnMajor));
+}
+
+int main(void)
+{
+    testTransposedResult(lhslib::maximinLHS, 30, 4, 3);
+    testTransposedResult(lhslib::improvedLHS, 30, 4, 3);
+    testTransposedResult(lhslib::maximinLHS, 7, 12, 1);
+    testTransposedResult(lhslib::improvedLHS, 7, 12, 1);
+    if (failures > 0)
+    {
+        std::printf("%d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
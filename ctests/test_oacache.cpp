@@ -0,0 +1,263 @@
+/**
+ * @file test_oacache.cpp
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License:  MIT
+ */
+
+/*
+ * Tests of the on-disk orthogonal array cache in OACache.h: a hit, a miss, a
+ * file written for another key, damaged files, and writers in forked
+ * processes.  The cache directory is the first argument.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "OACache.h"
+#include "COrthogonalArray.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define TEST_FORK
+#include <dirent.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+static int failures = 0;
+
+#define CHECK(cond) check((cond), #cond, __LINE__)
+
+static void check(bool ok, const char * expr, int line)
+{
+    if (!ok)
+    {
+        std::printf("FAILED line %d: %s\n", line, expr);
+        failures++;
+    }
+}
+
+static std::vector<char> readFile(const std::string & path)
+{
+    std::ifstream in(path.c_str(), std::ios::binary);
+    return std::vector<char>((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+}
+
+static void writeFile(const std::string & path, const std::vector<char> & contents)
+{
+    std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+    out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+static bool sameArray(const bclib::matrix<int> & A, const bclib::matrix<int> & B)
+{
+    if (A.rowsize() != B.rowsize() || A.colsize() != B.colsize())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < A.rowsize(); i++)
+    {
+        for (size_t j = 0; j < A.colsize(); j++)
+        {
+            if (A(i, j) != B(i, j))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void testHitAndMiss(const bclib::matrix<int> & oa)
+{
+    std::string key = oacpp::OACache::makeKey("bose", 7, 0, 5);
+    bclib::matrix<int> loaded;
+
+    CHECK(!oacpp::OACache::load(key, oa.rowsize(), oa.colsize(), loaded));
+    CHECK(oacpp::OACache::store(key, oa));
+    CHECK(oacpp::OACache::load(key, oa.rowsize(), oa.colsize(), loaded));
+    CHECK(sameArray(oa, loaded));
+    // other keys and other dimensions miss
+    CHECK(!oacpp::OACache::load(oacpp::OACache::makeKey("bose", 7, 0, 6), oa.rowsize(), 6, loaded));
+    CHECK(!oacpp::OACache::load(key, oa.rowsize() + 1, oa.colsize(), loaded));
+
+    // a construction reads the array back from the cache
+    oacpp::COrthogonalArray coa;
+    int n = 0;
+    coa.bose(7, 5, &n);
+    CHECK(sameArray(oa, coa.getoa()));
+}
+
+static void testKeyMismatch(const bclib::matrix<int> & oa)
+{
+    std::string key = oacpp::OACache::makeKey("bose", 7, 0, 4);
+    // the array written by another version of the library, placed under the file name of this version
+    std::string otherKey = "oacpp 0.0.0 bose q=7 param=0 ncol=4";
+    bclib::matrix<int> A(oa.rowsize(), 4);
+    for (size_t i = 0; i < A.rowsize(); i++)
+    {
+        for (size_t j = 0; j < A.colsize(); j++)
+        {
+            A(i, j) = oa(i, j);
+        }
+    }
+    bclib::matrix<int> loaded;
+    CHECK(oacpp::OACache::store(otherKey, A));
+    CHECK(oacpp::OACache::load(otherKey, A.rowsize(), A.colsize(), loaded));
+    CHECK(std::rename(oacpp::OACache::getPath(otherKey).c_str(), oacpp::OACache::getPath(key).c_str()) == 0);
+    CHECK(!oacpp::OACache::load(key, A.rowsize(), A.colsize(), loaded));
+}
+
+static void testCorruptFiles(const bclib::matrix<int> & oa)
+{
+    std::string key = oacpp::OACache::makeKey("bose", 7, 0, 3);
+    bclib::matrix<int> A(oa.rowsize(), 3);
+    for (size_t i = 0; i < A.rowsize(); i++)
+    {
+        for (size_t j = 0; j < A.colsize(); j++)
+        {
+            A(i, j) = oa(i, j);
+        }
+    }
+    bclib::matrix<int> loaded;
+    CHECK(oacpp::OACache::store(key, A));
+    std::string path = oacpp::OACache::getPath(key);
+    std::vector<char> good = readFile(path);
+    CHECK(good.size() > 100);
+
+    // a changed value in the middle of the elements
+    std::vector<char> damaged = good;
+    damaged[damaged.size() - 40] ^= 1;
+    writeFile(path, damaged);
+    CHECK(!oacpp::OACache::load(key, A.rowsize(), A.colsize(), loaded));
+
+    // a changed checksum
+    damaged = good;
+    damaged[damaged.size() - 1] ^= 1;
+    writeFile(path, damaged);
+    CHECK(!oacpp::OACache::load(key, A.rowsize(), A.colsize(), loaded));
+
+    // a truncated file
+    damaged = std::vector<char>(good.begin(), good.end() - 4);
+    writeFile(path, damaged);
+    CHECK(!oacpp::OACache::load(key, A.rowsize(), A.colsize(), loaded));
+
+    // a file of another format version
+    damaged = good;
+    damaged[7] = '1';
+    writeFile(path, damaged);
+    CHECK(!oacpp::OACache::load(key, A.rowsize(), A.colsize(), loaded));
+
+    // an empty file
+    writeFile(path, std::vector<char>());
+    CHECK(!oacpp::OACache::load(key, A.rowsize(), A.colsize(), loaded));
+
+    writeFile(path, good);
+    CHECK(oacpp::OACache::load(key, A.rowsize(), A.colsize(), loaded));
+    CHECK(sameArray(A, loaded));
+    std::remove(path.c_str());
+}
+
+#ifdef TEST_FORK
+static void testForkedWriters(const char * directory)
+{
+    // forked writers share the thread id and the write count of the parent.
+    // The array is large enough that their writes overlap
+    std::string key = oacpp::OACache::makeKey("forked", 7, 0, 100);
+    bclib::matrix<int> oa(5000, 100);
+    for (size_t i = 0; i < oa.rowsize(); i++)
+    {
+        for (size_t j = 0; j < oa.colsize(); j++)
+        {
+            oa(i, j) = static_cast<int>((i * j + i) % 7);
+        }
+    }
+    const int nchildren = 8;
+    std::vector<pid_t> children;
+    for (int c = 0; c < nchildren; c++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            for (int i = 0; i < 20; i++)
+            {
+                // a lost rename is allowed, a failed write is not
+                oacpp::OACache::store(key, oa);
+            }
+            bclib::matrix<int> loaded;
+            bool ok = oacpp::OACache::load(key, oa.rowsize(), oa.colsize(), loaded) && sameArray(oa, loaded);
+            _exit(ok ? 0 : 1);
+        }
+        children.push_back(pid);
+    }
+    for (size_t c = 0; c < children.size(); c++)
+    {
+        int status = 0;
+        CHECK(waitpid(children[c], &status, 0) == children[c]);
+        CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+    bclib::matrix<int> loaded;
+    CHECK(oacpp::OACache::load(key, oa.rowsize(), oa.colsize(), loaded));
+    CHECK(sameArray(oa, loaded));
+    std::remove(oacpp::OACache::getPath(key).c_str());
+
+    // every temporary file was renamed or removed
+    int temporaries = 0;
+    DIR * dir = opendir(directory);
+    CHECK(dir != NULL);
+    if (dir != NULL)
+    {
+        for (struct dirent * entry = readdir(dir); entry != NULL; entry = readdir(dir))
+        {
+            if (std::string(entry->d_name).find(".tmp") != std::string::npos)
+            {
+                temporaries++;
+            }
+        }
+        closedir(dir);
+    }
+    CHECK(temporaries == 0);
+}
+#endif
+
+int main(int argc, char * argv[])
+{
+    if (argc != 2)
+    {
+        std::printf("usage: test_oacache <empty cache directory>\n");
+        return EXIT_FAILURE;
+    }
+    // the reference array is built with the cache disabled
+    oacpp::OACache::setDirectory("");
+    CHECK(!oacpp::OACache::isEnabled());
+    CHECK(oacpp::OACache::getPath("key").empty());
+    oacpp::COrthogonalArray coa;
+    int n = 0;
+    coa.bose(7, 5, &n);
+    bclib::matrix<int> oa = coa.getoa();
+
+    oacpp::OACache::setDirectory(argv[1]);
+    CHECK(oacpp::OACache::isEnabled());
+    std::remove(oacpp::OACache::getPath(oacpp::OACache::makeKey("bose", 7, 0, 5)).c_str());
+    std::remove(oacpp::OACache::getPath(oacpp::OACache::makeKey("bose", 7, 0, 4)).c_str());
+    testHitAndMiss(oa);
+    testKeyMismatch(oa);
+    testCorruptFiles(oa);
+#ifdef TEST_FORK
+    testForkedWriters(argv[1]);
+#endif
+    std::remove(oacpp::OACache::getPath(oacpp::OACache::makeKey("bose", 7, 0, 5)).c_str());
+    std::remove(oacpp::OACache::getPath(oacpp::OACache::makeKey("bose", 7, 0, 4)).c_str());
+    oacpp::OACache::setDirectory("");
+
+    if (failures > 0)
+    {
+        std::printf("%d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -12,14 +12,15 @@ OALHSLIBDIR=../oa/src/oalhslib
 LHSLIBDIR=../lhslib/src/lhslib
 DESTDIR=src
 
-BCLIBSRCFILES="CRandom.h matrix.h order.h bclibVersion.h"
+BCLIBSRCFILES="CRandom.h matrix.h alignedMatrix.h order.h bclibVersion.h RunStatistics.h parallelFor.h"
 LHSLIBSRCFILES="LHSCommonDefines.h geneticLHS.cpp improvedLHS.cpp maximinLHS.cpp \
-  optimumLHS.cpp optSeededLHS.cpp randomLHS.cpp utilityLHS.cpp utilityLHS.h lhslibVersion.h"
+  optimumLHS.cpp optSeededLHS.cpp randomLHS.cpp blockedDistance.h simdDistance.cpp simdDistance.h utilityLHS.cpp utilityLHS.h lhslibVersion.h"
 OALIBSRCFILES="ak.h ak3.cpp akconst.cpp akn.cpp OACommonDefines.h \
   construct.cpp construct.h COrthogonalArray.cpp COrthogonalArray.h \
-  GaloisField.h GaloisField.cpp oa.cpp oa.h primes.cpp \
+  GaloisField.h GaloisField.cpp GaloisFieldCache.h GaloisFieldCache.cpp OACache.h OACache.cpp oa.cpp oa.h \
+  OARowGenerator.cpp OARowGenerator.h primes.cpp \
   primes.h runif.cpp runif.h rutils.cpp rutils.h xtn.h oalibVersion.h"
-OALHSLIBSRCFILES="oaLHS.cpp oaLHS.h oaLHSUtility.h"
+OALHSLIBSRCFILES="oaLHS.cpp oaLHS.h oaLHSUtility.h oaPlanner.cpp oaPlanner.h"
 
 echo Copying from bclib, oa, and lhslib to the lhs package...
 for f in $BCLIBSRCFILES; do cp $BCLIBDIR/$f $DESTDIR/$f; done;
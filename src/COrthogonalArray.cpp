@@ -34,11 +34,12 @@ COrthogonalArray::COrthogonalArray()
     m_return_code = SUCCESS_CHECK;
     m_warning_msg = "";
     m_randomClass = RUnif();
+    m_stats = NULL;
 }
 
 void COrthogonalArray::createGaloisField(int q)
 {
-    m_gf = GaloisField(q);
+    m_gf = GaloisFieldCache::getField(q);
 }
 
 void COrthogonalArray::checkDesignMemory()
@@ -71,6 +72,10 @@ void COrthogonalArray::checkResult(int result, int nvalue, int * n)
 	if (result == SUCCESS_CHECK)
 	{
 		*n = nvalue;
+		if (m_stats != NULL)
+		{
+			m_stats->addAllocation<int>(m_A.rowsize() * m_A.colsize());
+		}
 	}
 	else
 	{
@@ -78,15 +83,42 @@ void COrthogonalArray::checkResult(int result, int nvalue, int * n)
 	}
 }
 
+void COrthogonalArray::recordCheck(int tests, int result)
+{
+	if (m_stats != NULL)
+	{
+		m_stats->criterionEvaluations += static_cast<bclib::RunStatistics::count_type>(tests);
+		m_stats->criterionTrajectory.push_back(static_cast<double>(result));
+	}
+}
+
+template <class F>
+void COrthogonalArray::constructArray(const char * type, int q, int param, int k, int matrows, int fieldOrder,
+	F construct, int * n)
+{
+	std::string key = OACache::makeKey(type, q, param, k);
+	int result = SUCCESS_CHECK;
+	if (!OACache::load(key, matrows, k, m_A))
+	{
+		createGaloisField(fieldOrder);
+		m_A = bclib::matrix<int>(matrows, k);
+		checkDesignMemory();
+		result = construct(*m_gf, m_A);
+		if (result == SUCCESS_CHECK)
+		{
+			OACache::store(key, m_A);
+		}
+	}
+	checkResult(result, matrows, n);
+}
+
 void COrthogonalArray::addelkemp(int q, int k, int* n)
 {
+	bclib::PhaseTimer timer(m_stats, "construct");
 	k = checkMaxColumns(k, 2*q+1);
-	createGaloisField(q);
 	int matrows = 2 * q * q;
-    m_A = bclib::matrix<int>(matrows, k);
-	checkDesignMemory();
-	int result = oaconstruct::addelkemp(m_gf, m_A, k);
-	checkResult(result, 2*q*q, n);
+	constructArray("addelkemp", q, 0, k, matrows, q,
+		[k](const GaloisField & gf, bclib::matrix<int> & A) {return oaconstruct::addelkemp(gf, A, k);}, n);
 
     if (k == 2 * q + 1)
     {
@@ -112,13 +144,11 @@ void COrthogonalArray::addelkemp(int q, int k, int* n)
 
 void COrthogonalArray::addelkemp3(int q, int k, int* n)
 {
+	bclib::PhaseTimer timer(m_stats, "construct");
 	k = checkMaxColumns(k, 2*q*q + 2*q + 1); /*  2(q^3-1)/(q-1) - 1  */
-	createGaloisField(q);
 	int matrows = 2 * q * q * q;
-    m_A = bclib::matrix<int>(static_cast<size_t>(matrows), k);
-	checkDesignMemory();
-	int result = oaaddelkemp::addelkemp3(m_gf, m_A, k);
-	checkResult(result, 2*q*q*q, n);
+	constructArray("addelkemp3", q, 0, k, matrows, q,
+		[k](const GaloisField & gf, bclib::matrix<int> & A) {return oaaddelkemp::addelkemp3(gf, A, k);}, n);
     m_return_code = SUCCESS_CHECK;
     m_warning_msg = "";
     m_q = q; 
@@ -128,13 +158,11 @@ void COrthogonalArray::addelkemp3(int q, int k, int* n)
 
 void COrthogonalArray::addelkempn(int akn, int q, int k, int* n)
 {
+	bclib::PhaseTimer timer(m_stats, "construct");
 	k = checkMaxColumns(k, 2*(primes::ipow(q,akn)-1)/(q-1) - 1); /*  2(q^3-1)/(q-1) - 1  */
-	createGaloisField(q);
 	int matrows = 2 * primes::ipow(q, akn);
-    m_A = bclib::matrix<int>(matrows, k);
-	checkDesignMemory();
-	int result = oaaddelkemp::addelkempn(m_gf, akn, m_A, k);
-	checkResult(result, 2*primes::ipow(q,akn), n);
+	constructArray("addelkempn", q, akn, k, matrows, q,
+		[akn, k](const GaloisField & gf, bclib::matrix<int> & A) {return oaaddelkemp::addelkempn(gf, akn, A, k);}, n);
     m_return_code = SUCCESS_CHECK;
     m_warning_msg = "";
     m_q = q;
@@ -144,13 +172,11 @@ void COrthogonalArray::addelkempn(int akn, int q, int k, int* n)
 
 void COrthogonalArray::bose(int q, int k, int* n)
 {
+	bclib::PhaseTimer timer(m_stats, "construct");
 	k = checkMaxColumns(k, q+1);
-	createGaloisField(q);
 	int matrows = q * q;
-    m_A = bclib::matrix<int>(matrows, k);
-	checkDesignMemory();
-	int result = oaconstruct::bose(m_gf, m_A, k);
-	checkResult(result, q*q, n);
+	constructArray("bose", q, 0, k, matrows, q,
+		[k](const GaloisField & gf, bclib::matrix<int> & A) {return oaconstruct::bose(gf, A, k);}, n);
     m_return_code = SUCCESS_CHECK;
     m_warning_msg = "";
     m_q = q;
@@ -160,18 +186,16 @@ void COrthogonalArray::bose(int q, int k, int* n)
 
 void COrthogonalArray::bosebush(int q, int k, int *n)
 {
+	bclib::PhaseTimer timer(m_stats, "construct");
 	if (q % 2 != 0)
 	{
 		throw std::runtime_error("This implementation of Bose-Bush only works for a number of levels equal to a power of 2");
 	}
 	k = checkMaxColumns(k, 2*q + 1);
     int q_star = 2 * q;
-	createGaloisField(q_star);
 	int matrows = 2 * q * q;
-    m_A = bclib::matrix<int>(matrows, k);
-	checkDesignMemory();
-	int result = oaconstruct::bosebush(m_gf, m_A, k);
-	checkResult(result, 2*q*q, n);
+	constructArray("bosebush", q, 0, k, matrows, q_star,
+		[k](const GaloisField & gf, bclib::matrix<int> & A) {return oaconstruct::bosebush(gf, A, k);}, n);
 
     if (k == 2 * q + 1) 
     {
@@ -195,6 +219,7 @@ void COrthogonalArray::bosebush(int q, int k, int *n)
 
 void COrthogonalArray::bosebushl(int lambda, int q, int k, int* n)
 {
+	bclib::PhaseTimer timer(m_stats, "construct");
 	int pq, nq, isppq,  pl, nl, isppl;
 
 	k = checkMaxColumns(k, q*lambda + 1);
@@ -215,12 +240,9 @@ void COrthogonalArray::bosebushl(int lambda, int q, int k, int* n)
 		throw std::runtime_error("The Bose-Bush design requires that lambda and q be powers of the same prime.");
 	}
 
-	createGaloisField(lambda*q);
 	int matrows = lambda * q * q;
-    m_A = bclib::matrix<int>(matrows, k);
-	checkDesignMemory();
-	int result = oaconstruct::bosebushl(m_gf, lambda, m_A, k);
-	checkResult(result, lambda*q*q, n);
+	constructArray("bosebushl", q, lambda, k, matrows, lambda*q,
+		[lambda, k](const GaloisField & gf, bclib::matrix<int> & A) {return oaconstruct::bosebushl(gf, lambda, A, k);}, n);
 
     if (k == lambda * q + 1)
     {
@@ -245,14 +267,12 @@ void COrthogonalArray::bosebushl(int lambda, int q, int k, int* n)
 
 void COrthogonalArray::bush(int q, int k, int* n)
 {
+	bclib::PhaseTimer timer(m_stats, "construct");
 	k = checkMaxColumns(k, q+1);
-	createGaloisField(q);
 	int matrows = q * q * q;
     int str = 3;
-    m_A = bclib::matrix<int>(matrows, k);
-	checkDesignMemory();
-	int result = oaconstruct::bush(m_gf, m_A, str, k);
-	checkResult(result, q*q*q, n);
+	constructArray("busht", q, str, k, matrows, q,
+		[str, k](const GaloisField & gf, bclib::matrix<int> & A) {return oaconstruct::bush(gf, A, str, k);}, n);
     if (str >= q + 1)
     {
         std::ostringstream msg;
@@ -276,17 +296,16 @@ void COrthogonalArray::bush(int q, int k, int* n)
 
 void COrthogonalArray::busht(int str, int q, int k, int* n)
 {
+	bclib::PhaseTimer timer(m_stats, "construct");
 	k = checkMaxColumns(k, q+1);
 	if (str < 2)
 	{
 		throw std::runtime_error("Bush designs not provided for strength < 2");
 	}
 
-	createGaloisField(q);
-    m_A = bclib::matrix<int>(primes::ipow(q,str), k);
-	checkDesignMemory();
-	int result = oaconstruct::bush(m_gf, m_A, str, k);
-	checkResult(result, primes::ipow(q,str), n);
+	int matrows = primes::ipow(q,str);
+	constructArray("busht", q, str, k, matrows, q,
+		[str, k](const GaloisField & gf, bclib::matrix<int> & A) {return oaconstruct::bush(gf, A, str, k);}, n);
     m_return_code = SUCCESS_CHECK;
     m_warning_msg = "";
     m_q = q;
@@ -296,6 +315,7 @@ void COrthogonalArray::busht(int str, int q, int k, int* n)
 
 int COrthogonalArray::oaagree(bool verbose)
 {
+	bclib::PhaseTimer timer(m_stats, "check");
 	int agree, maxagr;
 	int mrow1, mrow2;
 	maxagr = mrow1 = mrow2 = 0;
@@ -337,11 +357,13 @@ int COrthogonalArray::oaagree(bool verbose)
 		  PRINT_OUTPUT << "This is attained by rows " << mrow1 << " and " << mrow2 << ".\n";
 		}
 	} // LCOV_EXCL_STOP
+	recordCheck(1, maxagr);
 	return maxagr;
 }
 
 int COrthogonalArray::oatriple(bool verbose)
 {
+	bclib::PhaseTimer timer(m_stats, "check");
 	/* Count triple agreements among rows of an array */
 	int a3/*, q*/;
 	int num3 = 0;
@@ -376,25 +398,63 @@ int COrthogonalArray::oatriple(bool verbose)
 		PRINT_OUTPUT << "There are " << num3 << " distinct triples of columns that agree\n";
 		PRINT_OUTPUT << "in at least two distinct rows.\n";
 	} // LCOV_EXCL_STOP
+	recordCheck(1, num3);
 	return num3;
 }
 
 void COrthogonalArray::oarand(int is, int js, int ks, int ls)
 {
     m_randomClass.seed(is, js, ks, ls);
-    std::vector<int> pi = std::vector<int>(m_q);
-	for (int j = 0; j < m_ncol; j++)
+	if (m_ncol <= 0 || m_q <= 0)
+	{
+		return;
+	}
+	// one call draws the same stream as one call of q values per column
+	std::vector<double> z(static_cast<size_t>(m_ncol) * static_cast<size_t>(m_q));
+	m_randomClass.runif(z, m_ncol * m_q);
+	if (m_stats != NULL)
 	{
-        rutils::unifperm(pi, m_q, m_randomClass);
-		for (int i = 0; i < m_nrow; i++)
+		m_stats->randomDraws += static_cast<bclib::RunStatistics::count_type>(z.size());
+	}
+
+	size_t uq = static_cast<size_t>(m_q);
+	std::vector<int> perms(z.size());
+	std::vector<double> zcol(uq);
+	std::vector<int> pi(uq);
+	for (size_t j = 0; j < static_cast<size_t>(m_ncol); j++)
+	{
+		std::copy(z.begin() + j * uq, z.begin() + (j + 1) * uq, zcol.begin());
+		rutils::findranks_zero<double>(zcol, pi);
+		std::copy(pi.begin(), pi.end(), perms.begin() + j * uq);
+	}
+
+	// each thread relabels a contiguous range of rows so the writes to m_A are disjoint
+	size_t unrow = static_cast<size_t>(m_nrow);
+	bclib::parallelForRange(unrow, bclib::threadsForWork(unrow, OA_MIN_ROWS_PER_THREAD),
+		[this, &perms](size_t firstRow, size_t lastRow)
+		{
+			permuteRows(perms, firstRow, lastRow);
+		});
+}
+
+void COrthogonalArray::permuteRows(const std::vector<int> & perms, size_t firstRow, size_t lastRow)
+{
+	size_t uncol = static_cast<size_t>(m_ncol);
+	size_t uq = static_cast<size_t>(m_q);
+	for (size_t i = firstRow; i < lastRow; i++)
+	{
+		// the permutation of column j starts at perms[j*q]
+		const int * table = perms.data();
+		for (size_t j = 0; j < uncol; j++, table += uq)
 		{
-			m_A(i,j) = pi[ m_A(i,j) ];
+			m_A(i, j) = table[m_A(i, j)];
 		}
 	}
 }
 
 int COrthogonalArray::oastr(bool verbose)
 {
+	bclib::PhaseTimer timer(m_stats, "check");
 	int str;
 	int bverb = (verbose) ? ALLMESSAGES : NOMESSAGES;
 	oastrength::OA_strength(m_q, m_A, &str, bverb);
@@ -411,37 +471,69 @@ int COrthogonalArray::oastr(bool verbose)
 		  PRINT_OUTPUT << "\nThe array has strength " << str << " and no higher strength.\n";
 		}
 	} // LCOV_EXCL_STOP
+	// OA_strength tests strengths 0, 1, ... until one fails
+	recordCheck(str + 2, str);
 	return str;
 }
 
 bool COrthogonalArray::oastr1(bool verbose)
 {
+	bclib::PhaseTimer timer(m_stats, "check");
 	int bverb = (verbose) ? ALLMESSAGES : NOMESSAGES;
-    return (oastrength::OA_str1(m_q, m_A, bverb) == SUCCESS_CHECK);
+	bool bResult = (oastrength::OA_str1(m_q, m_A, bverb) == SUCCESS_CHECK);
+	recordCheck(1, bResult ? 1 : 0);
+	return bResult;
 }
 
 bool COrthogonalArray::oastr2(bool verbose)
 {
+	bclib::PhaseTimer timer(m_stats, "check");
 	int bverb = (verbose) ? ALLMESSAGES : NOMESSAGES;
-    return (oastrength::OA_str2(m_q, m_A, bverb) == SUCCESS_CHECK);
+	bool bResult = (oastrength::OA_str2(m_q, m_A, bverb) == SUCCESS_CHECK);
+	recordCheck(1, bResult ? 1 : 0);
+	return bResult;
 }
 
 bool COrthogonalArray::oastr3(bool verbose)
 {
+	bclib::PhaseTimer timer(m_stats, "check");
 	int bverb = (verbose) ? ALLMESSAGES : NOMESSAGES;
-    return (oastrength::OA_str3(m_q, m_A, bverb) == SUCCESS_CHECK);
+	bool bResult = (oastrength::OA_str3(m_q, m_A, bverb) == SUCCESS_CHECK);
+	recordCheck(1, bResult ? 1 : 0);
+	return bResult;
 }
 
 bool COrthogonalArray::oastr4(bool verbose)
 {
+	bclib::PhaseTimer timer(m_stats, "check");
 	int bverb = (verbose) ? ALLMESSAGES : NOMESSAGES;
-    return (oastrength::OA_str4(m_q, m_A, bverb) == SUCCESS_CHECK);
+	bool bResult = (oastrength::OA_str4(m_q, m_A, bverb) == SUCCESS_CHECK);
+	recordCheck(1, bResult ? 1 : 0);
+	return bResult;
 }
 
 bool COrthogonalArray::oastrt(int t, bool verbose)
 {
+	bclib::PhaseTimer timer(m_stats, "check");
+	int bverb = (verbose) ? ALLMESSAGES : NOMESSAGES;
+	bool bResult = (oastrength::OA_strt(m_q, m_A, t, bverb) == SUCCESS_CHECK);
+	recordCheck(1, bResult ? 1 : 0);
+	return bResult;
+}
+
+bool COrthogonalArray::oastrt_sampled(int t, int samples, double confidence, double * violationBound, bool verbose)
+{
+	bclib::PhaseTimer timer(m_stats, "check");
 	int bverb = (verbose) ? ALLMESSAGES : NOMESSAGES;
-	return (oastrength::OA_strt(m_q, m_A, t, bverb) == SUCCESS_CHECK);
+	bool bResult = (oastrength::OA_strt_sampled(m_q, m_A, t, samples, confidence, m_randomClass,
+		violationBound, bverb) == SUCCESS_CHECK);
+	recordCheck(1, bResult ? 1 : 0);
+	return bResult;
+}
+
+bool COrthogonalArray::oastrt_sampled(int t, double confidence, double * violationBound, bool verbose)
+{
+	return oastrt_sampled(t, SAMPLEDSTR_DEFAULT_TUPLES, confidence, violationBound, verbose);
 }
 
 } // end namespace
@@ -27,11 +27,15 @@
 
 #include "OACommonDefines.h"
 #include "GaloisField.h"
+#include "GaloisFieldCache.h"
+#include "OACache.h"
 #include "construct.h"
 #include "runif.h"
 #include "rutils.h"
 #include "oa.h"
 #include "primes.h"
+#include "RunStatistics.h"
+#include "parallelFor.h"
 
 /** The number of rows of the oa to check and print */
 #define ROWCHECK 50
@@ -50,6 +54,8 @@ namespace oacpp {
      * Orthogonal Array Class
      * 
      * A collection of functions used as an API for Art Owen's oa library.
+     * The constructions read and write the on-disk <code>OACache</code> when
+     * it is enabled.
      */
 	class COrthogonalArray
 	{
@@ -420,6 +426,12 @@ namespace oacpp {
          * to 1.
          * </blockquote>
          * 
+         * The permutations of all columns are drawn in one call to the random
+         * number generator and applied as per-column lookup tables in a single
+         * pass over the rows.  Large arrays are relabeled on up to
+         * <code>bclib::getMaxThreads()</code> threads, each with at least
+         * <code>OA_MIN_ROWS_PER_THREAD</code> rows.
+         * 
          * @param is seed
          * @param js seed
          * @param ks seed
@@ -538,6 +550,30 @@ namespace oacpp {
 		 */
 		bool oastrt(int t, bool verbose);
 
+		/**
+		 * Similar to oastrt, but only checking a random sample of the column tuples
+		 * @see oastrength::OA_strt_sampled
+		 * @param t the strength to check for
+		 * @param samples the number of column tuples to sample
+		 * @param confidence the confidence level of the bound
+		 * @param violationBound the upper bound on the fraction of violating column tuples
+		 * @param verbose should diagnostic messages be printed?
+		 * @return true if no sampled column tuple violates strength t
+		 */
+		bool oastrt_sampled(int t, int samples, double confidence, double * violationBound, bool verbose);
+
+		/**
+		 * Similar to oastrt, but only checking <code>SAMPLEDSTR_DEFAULT_TUPLES</code>
+		 * randomly sampled column tuples
+		 * @see oastrength::OA_strt_sampled
+		 * @param t the strength to check for
+		 * @param confidence the confidence level of the bound
+		 * @param violationBound the upper bound on the fraction of violating column tuples
+		 * @param verbose should diagnostic messages be printed?
+		 * @return true if no sampled column tuple violates strength t
+		 */
+		bool oastrt_sampled(int t, double confidence, double * violationBound, bool verbose);
+
         /**
          * row accessor
          * @return the number of rows in the orthogonal array
@@ -568,9 +604,21 @@ namespace oacpp {
          * @return the return code
          */
         int getReturnCode();
+        /**
+         * Collect the statistics of the following constructions and checks
+         *
+         * A construction is timed as the <code>construct</code> phase and adds
+         * the storage of the array.  A strength check is timed as the
+         * <code>check</code> phase, each strength tested is a criterion
+         * evaluation, and the result is added to the trajectory.
+         * <code>oarand</code> adds its random numbers.
+         *
+         * @param stats the statistics, or <code>NULL</code> to stop collecting
+         */
+        void setStatistics(bclib::RunStatistics * stats);
 
 	private:
-        GaloisField m_gf; /**< Galois Field */
+        std::shared_ptr<const GaloisField> m_gf; /**< Galois Field shared through the GaloisFieldCache */
         bclib::matrix<int> m_A; /**< Orthogonal Array */
 		int m_nrow; /**< the number of rows in orthogonal array */
         int m_ncol; /**< the number of columns in the orthogonal array */
@@ -578,9 +626,25 @@ namespace oacpp {
         RUnif m_randomClass; /**< a pseudo random number generator */
         int m_return_code;
         std::string m_warning_msg;
+        bclib::RunStatistics * m_stats; /**< the statistics of the run, or NULL */
+
+        /**
+         * Record one strength check
+         * @param tests the number of strengths tested
+         * @param result the strength found, or 1 if the check passed and 0 if it failed
+         */
+        void recordCheck(int tests, int result);
+
+		/**
+         * Relabel the symbols of a range of rows
+         * @param perms the permutation of each column, <code>q</code> values per column
+         * @param firstRow the first row in the range
+         * @param lastRow one past the last row in the range
+         */
+        void permuteRows(const std::vector<int> & perms, size_t firstRow, size_t lastRow);
 
 		/**
-         * Create a Galois Field
+         * Get the Galois Field from the process-wide cache, creating it if necessary
          * @param q the number of symbols <code>(0,...,q-1)</code>
          * @throws std::runtime_error
         */
@@ -607,6 +671,23 @@ namespace oacpp {
          * @throws std::runtime_error
          */
 		void checkResult(int result, int nvalue, int * n);
+        /**
+         * Load an array from the OACache or construct it and store it in the cache
+         *
+         * @param type the construction in the cache key
+         * @param q the number of symbols <code>(0,...,q-1)</code>
+         * @param param the construction parameter in the cache key, otherwise 0
+         * @param k the number of columns
+         * @param matrows the number of rows in the array
+         * @param fieldOrder the order of the Galois Field the construction uses
+         * @param construct called as <code>construct(gf, A)</code> to fill the array, returning SUCCESS_CHECK
+         * @param n [out] the number of rows
+         * @tparam F a function object
+         * @throws std::runtime_error
+         */
+		template <class F>
+		void constructArray(const char * type, int q, int param, int k, int matrows, int fieldOrder,
+			F construct, int * n);
 	};
 
 	inline
@@ -646,6 +727,11 @@ namespace oacpp {
     {
         return m_warning_msg;
     }
+    inline
+    void COrthogonalArray::setStatistics(bclib::RunStatistics * stats)
+    {
+        m_stats = stats;
+    }
 
 }
 
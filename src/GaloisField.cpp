@@ -31,16 +31,76 @@
  */
 
 #include "GaloisField.h"
+#include "xtn.h"
+
+/*
+ * The carry-less product is compiled with a target attribute so that the
+ * package can be built with the default compiler flags and still use the
+ * PCLMUL instruction of the processor it runs on.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define GF_CLMUL_X86
+#include <immintrin.h>
+#define GF_TARGET_PCLMUL __attribute__((target("pclmul,sse2")))
+#endif
 
 namespace oacpp
 {
-    std::vector<int> GaloisField::initializePowerCycle(int q)
+    /**
+     * Carry-less product of two packed binary polynomials by shift and XOR
+     * @param a polynomial 1
+     * @param b polynomial 2
+     * @return the unreduced product
+     */
+    static unsigned long long clmulPortable(unsigned long long a, unsigned long long b)
     {
-        std::vector<int> xtn;
+        unsigned long long c = 0ULL;
+        while (b != 0ULL)
+        {
+            if (b & 1ULL)
+            {
+                c ^= a;
+            }
+            a <<= 1;
+            b >>= 1;
+        }
+        return c;
+    }
 
-#include "xtn.h"
+#ifdef GF_CLMUL_X86
+    /**
+     * Carry-less product of two packed binary polynomials with the PCLMUL instruction
+     * @param a polynomial 1
+     * @param b polynomial 2
+     * @return the low 64 bits of the unreduced product
+     */
+    GF_TARGET_PCLMUL static unsigned long long clmulHardware(unsigned long long a, unsigned long long b)
+    {
+        __m128i clmul = _mm_clmulepi64_si128(_mm_cvtsi64_si128(static_cast<long long>(a)),
+            _mm_cvtsi64_si128(static_cast<long long>(b)), 0x00);
+        return static_cast<unsigned long long>(_mm_cvtsi128_si64(clmul));
+    }
 
-        return xtn;
+    /**
+     * Does the processor have the carry-less multiplication instruction
+     * @return true if PCLMUL is supported
+     */
+    static bool hasPclmul()
+    {
+        // function local statics are initialized once in a thread-safe way
+        static const bool supported = (__builtin_cpu_init(), __builtin_cpu_supports("pclmul") != 0);
+        return supported;
+    }
+#endif
+
+    std::vector<int> GaloisField::initializePowerCycle(int p, int n)
+    {
+        const int * coef = xtn::lookup(p, n);
+        if (coef == nullptr)
+        {
+            return std::vector<int>();
+        }
+        return std::vector<int>(coef, coef + n);
     }
 
     void GaloisField::fillAllPolynomials()
@@ -68,91 +128,158 @@ namespace oacpp
         }
     }
 
+    bool GaloisField::computeLogarithms(int generator)
+    {
+        assert(u_q > 1 && !poly.isEmpty()); // NOLINT
+        size_t qm1 = u_q - 1;
+        logs.assign(u_q, -1);
+        antilogs.assign(qm1, 0);
+
+        std::vector<int> gpoly = poly.getrow(static_cast<size_t>(generator));
+        std::vector<int> current = poly.getrow(1);
+        std::vector<int> next(u_n);
+        for (size_t k = 0; k < qm1; k++)
+        {
+            int element = GaloisField::poly2int(p, n, current);
+            // a primitive element cycles through every non-zero element before returning to 1
+            if (element == 0 || logs[static_cast<size_t>(element)] != -1)
+            {
+                return false;
+            }
+            logs[static_cast<size_t>(element)] = static_cast<int>(k);
+            antilogs[k] = element;
+
+            if (n == 1)
+            {
+                long long prod = static_cast<long long>(current[0]) * static_cast<long long>(generator);
+                next[0] = static_cast<int>(prod % static_cast<long long>(p));
+            }
+            else if (generator == p)
+            {
+                // multiplication by x is a shift with the x^n term replaced by xton
+                int carry = current[u_n - 1];
+                next[0] = (carry * xton[0]) % p;
+                for (size_t j = 1; j < u_n; j++)
+                {
+                    next[j] = (current[j - 1] + carry * xton[j]) % p;
+                }
+            }
+            else
+            {
+                GaloisField::polyProd(p, u_n, xton, current, gpoly, next);
+            }
+            current.swap(next);
+        }
+        return GaloisField::poly2int(p, n, current) == 1;
+    }
+
+    void GaloisField::computeZechLogarithms()
+    {
+        assert(u_q > 1 && antilogs.size() == u_q - 1); // NOLINT
+        if (p == 2)
+        {
+            zech.clear();
+            return;
+        }
+        zech = std::vector<int>(u_q - 1);
+        for (size_t k = 0; k < u_q - 1; k++)
+        {
+            // 1 + a^k only changes the constant coefficient of a^k
+            int element = antilogs[k];
+            int constant = element % p;
+            int sum = element - constant + (constant + 1) % p;
+            zech[k] = logs[static_cast<size_t>(sum)];
+        }
+    }
+
     void GaloisField::computeSumsAndProducts()
     {
         assert(u_n > 0 && u_q > 0); // NOLINT
         assert(poly.rowsize() == u_q && xton.size() == u_n && poly.colsize() == u_n); // NOLINT
-        
-        std::vector<int> temppoly(u_n);
-        plus = bclib::matrix<int>(u_q, u_q);
-        times = bclib::matrix<int>(u_q, u_q);
 
+        m_plus.clear();
+        m_times.clear();
+        if (u_q > GF_FULL_TABLE_MAX)
+        {
+            return;
+        }
+        m_plus = getPlusTable();
+        m_times = getTimesTable();
+    }
+
+    bclib::matrix<int> GaloisField::getPlusTable() const
+    {
+        if (!m_plus.isEmpty())
+        {
+            return m_plus;
+        }
+        bclib::matrix<int> table(u_q, u_q);
         for (size_t i = 0; i < u_q; i++)
         {
             for (size_t j = 0; j < u_q; j++)
             {
-                GaloisField::polySum(p, u_n, poly.getrow(i), poly.getrow(j), temppoly);
-                plus(i, j) = GaloisField::poly2int(p, n, temppoly);
-                GaloisField::polyProd(p, u_n, xton, poly.getrow(i), poly.getrow(j), temppoly);
-                times(i, j) = GaloisField::poly2int(p, n, temppoly);
+                table(i, j) = addElements(i, j);
             }
         }
+        return table;
     }
 
-    void GaloisField::computeMultiplicativeInverse()
+    bclib::matrix<int> GaloisField::getTimesTable() const
     {
-        assert(u_q > 0 && !times.isEmpty());  // NOLINT
-        inv = std::vector<int>(u_q);
-        std::ostringstream msg;
-
+        if (!m_times.isEmpty())
+        {
+            return m_times;
+        }
+        bclib::matrix<int> table(u_q, u_q);
         for (size_t i = 0; i < u_q; i++)
         {
-            inv[i] = -1;
             for (size_t j = 0; j < u_q; j++)
             {
-                if (times(i, j) == 1)
-                {
-                    inv[i] = static_cast<int>(j);
-                }
+                table(i, j) = multiplyElements(i, j);
             }
-            if (i > 0 && inv[i] <= 0)
-            { // LCOV_EXCL_START
-                msg << "There is something wrong with the Galois field\n";
-                msg << "used for q=" << q << ".  Element " << i << "has no reciprocal.\n";
-                ostringstream_runtime_error(msg);
-            } // LCOV_EXCL_STOP
+        }
+        return table;
+    }
+
+    void GaloisField::computeMultiplicativeInverse()
+    {
+        assert(u_q > 1 && logs.size() == u_q); // NOLINT
+        size_t qm1 = u_q - 1;
+        inv = std::vector<int>(u_q);
+
+        inv[0] = -1;
+        for (size_t i = 1; i < u_q; i++)
+        {
+            size_t logi = static_cast<size_t>(logs[i]);
+            inv[i] = antilogs[(qm1 - logi) % qm1];
         }
     }
 
     void GaloisField::computeNegative()
     {
-        assert(u_q > 0 && !plus.isEmpty()); // NOLINT
+        assert(u_q > 0 && !poly.isEmpty()); // NOLINT
         neg = std::vector<int>(u_q);
-        std::ostringstream msg;
+        std::vector<int> negpoly(u_n);
 
         for (size_t i = 0; i < u_q; i++)
         {
-            neg[i] = -1;
-            for (size_t j = 0; j < u_q; j++)
+            for (size_t j = 0; j < u_n; j++)
             {
-                if (plus(i, j) == 0)
-                {
-                    neg[i] = static_cast<int>(j);
-                }
+                negpoly[j] = (p - poly(i, j)) % p;
             }
-            if (i > 0 && neg[i] <= 0)
-            { // LCOV_EXCL_START
-                msg << "There is something wrong with the Galois field\n";
-                msg << "used for q=" << q << ".  Element " << i << " has no negative.\n";
-                ostringstream_runtime_error(msg);
-            } // LCOV_EXCL_STOP
+            neg[i] = GaloisField::poly2int(p, n, negpoly);
         }
     }
 
     void GaloisField::computeRoots()
     {
-        assert(u_q > 0 && !times.isEmpty()); // NOLINT
-        root = std::vector<int>(u_q);
-        for (size_t i = 0; i < u_q; i++)
+        assert(u_q > 1 && logs.size() == u_q); // NOLINT
+        root = std::vector<int>(u_q, -1);
+        root[0] = 0;
+        // ascending j so that the largest square root is retained
+        for (size_t j = 1; j < u_q; j++)
         {
-            root[i] = -1;
-            for (size_t j = 0; j < u_q; j++)
-            {
-                if (times(j, j) == static_cast<int>(i))
-                {
-                    root[i] = static_cast<int>(j);
-                }
-            }
+            root[static_cast<size_t>(multiplyElements(j, j))] = static_cast<int>(j);
         }
     }
 
@@ -185,13 +312,13 @@ namespace oacpp
             ostringstream_runtime_error(msg);
         }
 
-        if (primes::isprime(q) != 0)
+        if (n == 1)
         {
-            xton = { 0 }; /* Could have tested p=q, or n=1 */
+            xton = { 0 };
         }
         else
         {
-            xton = GaloisField::initializePowerCycle(q);
+            xton = GaloisField::initializePowerCycle(p, n);
         }
 
         if (xton.empty())
@@ -203,6 +330,20 @@ namespace oacpp
 
         // create a matrix containing all polynomials in the Galois Field
         fillAllPolynomials();
+        // find a primitive element and its log / antilog tables.  x is primitive for the
+        //   tabulated characteristic polynomials, so the search normally ends immediately
+        bool bPrimitive = computeLogarithms((n > 1) ? p : 1);
+        for (int g = 2; !bPrimitive && g < q; g++)
+        {
+            bPrimitive = computeLogarithms(g);
+        }
+        if (!bPrimitive)
+        { // LCOV_EXCL_START
+            msg << "There is something wrong with the Galois field\n";
+            msg << "used for q=" << q << ".  No primitive element was found.\n";
+            ostringstream_runtime_error(msg);
+        } // LCOV_EXCL_STOP
+        computeZechLogarithms();
         // fill sum and product tables of the Galois Field
         computeSumsAndProducts();
         // compute multiplicative inverse polynomial index
@@ -238,6 +379,22 @@ namespace oacpp
     {
         assert(p > 0 && u_n > 0); // NOLINT
         assert(xton.size() == u_n && p1.size() == u_n && p2.size() == u_n && prod.size() == u_n); // NOLINT
+
+        if (p == 2 && u_n <= GF_CLMUL_MAX_N)
+        {
+            // characteristic 2 polynomials fit in one machine word
+            unsigned long long a, b, reduction;
+            if (packBinaryPoly(p1, &a) && packBinaryPoly(p2, &b) && packBinaryPoly(xton, &reduction))
+            {
+                unsigned long long c = binaryPolyProd(a, b, u_n, reduction);
+                for (size_t i = 0; i < u_n; i++)
+                {
+                    prod[i] = static_cast<int>((c >> i) & 1ULL);
+                }
+                return;
+            }
+        }
+
         int n = static_cast<int>(u_n);
         std::vector<int> longprod(2 * u_n - 1);
 
@@ -263,6 +420,45 @@ namespace oacpp
         }
     }
 
+    bool GaloisField::packBinaryPoly(const std::vector<int> & poly, unsigned long long * packed)
+    {
+        *packed = 0ULL;
+        for (size_t i = 0; i < poly.size(); i++)
+        {
+            if (poly[i] == 1)
+            {
+                *packed |= (1ULL << i);
+            }
+            else if (poly[i] != 0)
+            {
+                // coefficients outside 0..1 are left to the general product
+                return false;
+            }
+        }
+        return true;
+    }
+
+    unsigned long long GaloisField::binaryPolyProd(unsigned long long a, unsigned long long b,
+        size_t u_n, unsigned long long reduction)
+    {
+        assert(u_n > 0 && u_n <= GF_CLMUL_MAX_N); // NOLINT
+        // carry-less product of two polynomials of degree < n has degree <= 2n - 2 < 64
+#ifdef GF_CLMUL_X86
+        unsigned long long c = hasPclmul() ? clmulHardware(a, b) : clmulPortable(a, b);
+#else
+        unsigned long long c = clmulPortable(a, b);
+#endif
+        // x^n = xton, so each term x^i with i >= n is replaced by xton x^(i-n)
+        for (size_t i = 2 * u_n - 2; i >= u_n; i--)
+        {
+            if ((c >> i) & 1ULL)
+            {
+                c ^= (1ULL << i) | (reduction << (i - u_n));
+            }
+        }
+        return c & ((1ULL << u_n) - 1ULL);
+    }
+
     int GaloisField::poly2int(int p, int n, const std::vector<int> & poly)
     {
         assert(p > 0 && n > 0); // NOLINT
@@ -279,6 +475,15 @@ namespace oacpp
         return ans;
     }
 
+    size_t GaloisField::getMemoryBytes() const
+    {
+        size_t elements = xton.size() + inv.size() + neg.size() + root.size() +
+            logs.size() + antilogs.size() + zech.size() +
+            m_plus.rowsize() * m_plus.colsize() + m_times.rowsize() * m_times.colsize() +
+            poly.rowsize() * poly.colsize();
+        return sizeof(GaloisField) + elements * sizeof(int);
+    }
+
     void GaloisField::print() // LCOV_EXCL_START
     {
         if (q > 999)
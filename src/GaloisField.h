@@ -19,6 +19,19 @@
 #include "primes.h"
 #include <assert.h>
 
+/**
+ * The largest field for which the full u_q x u_q sum and product tables are stored.
+ * Larger fields use the log / antilog tables of a primitive element.
+ */
+#define GF_FULL_TABLE_MAX 256
+
+/**
+ * The largest extension degree n for which products in GF(2^n) are computed
+ * with carry-less multiplication of packed words.  The unreduced product has
+ * degree at most 2n - 2 and must fit in 64 bits.
+ */
+#define GF_CLMUL_MAX_N 32
+
 namespace oacpp {
     /**
      * Class to define a Galois Field and Methods for operations
@@ -26,12 +39,47 @@ namespace oacpp {
     class GaloisField
     {
     private:
+        /** sum field of dimension u_q x u_q, only stored when u_q <= GF_FULL_TABLE_MAX */
+        bclib::matrix<int> m_plus;
+        /** product field of dimension u_q x u_q, only stored when u_q <= GF_FULL_TABLE_MAX */
+        bclib::matrix<int> m_times;
+
         void fillAllPolynomials();
+        bool computeLogarithms(int generator);
+        void computeZechLogarithms();
         void computeSumsAndProducts();
         void computeMultiplicativeInverse();
         void computeNegative();
         void computeRoots();
-        static std::vector<int> initializePowerCycle(int q);
+        /**
+         * Characteristic polynomial of GF(p^n) from the compile time table in xtn.h
+         * @param p the prime base
+         * @param n the exponent, n >= 2
+         * @return the polynomial of length n, or an empty vector if the field is not tabulated
+         */
+        static std::vector<int> initializePowerCycle(int p, int n);
+        /**
+         * Pack a polynomial over GF(2) into a word with bit i holding the coefficient of x^i
+         * @param poly the polynomial coefficients
+         * @param packed the packed polynomial
+         * @return false if any coefficient is not 0 or 1
+         */
+        static bool packBinaryPoly(const std::vector<int> & poly, unsigned long long * packed);
+
+        /**
+         * Sum of two field elements from the Zech logarithms
+         * @param i field element
+         * @param j field element
+         * @return the field element <code>i + j</code>
+         */
+        int addElements(size_t i, size_t j) const;
+        /**
+         * Product of two field elements from the logarithm tables
+         * @param i field element
+         * @param j field element
+         * @return the field element <code>i * j</code>
+         */
+        int multiplyElements(size_t i, size_t j) const;
 
     public:
         /** prime modulus exponent q = p^n*/
@@ -52,10 +100,12 @@ namespace oacpp {
         std::vector<int> neg;
         /** root */
         std::vector<int> root;
-        /** sum field of dimension u_q x u_q*/
-        bclib::matrix<int> plus;
-        /** product field of dimension u_q x u_q*/
-        bclib::matrix<int> times;
+        /** discrete logarithm of each element to the base of a primitive element of length u_q, the log of 0 is -1 */
+        std::vector<int> logs;
+        /** powers of the primitive element (antilogarithms) of length u_q - 1 */
+        std::vector<int> antilogs;
+        /** Zech logarithms <code>log(1 + a^k)</code> of length u_q - 1 (-1 when the sum is 0), empty when p = 2 */
+        std::vector<int> zech;
         /** polynomial field of dimension u_q x u_n */
         bclib::matrix<int> poly;
 
@@ -69,9 +119,40 @@ namespace oacpp {
          */
         GaloisField();
 
+        /**
+         * Addition in the field
+         * @param i field element in <code>0..q-1</code>
+         * @param j field element in <code>0..q-1</code>
+         * @return the field element <code>i + j</code>
+         */
+        int plus(size_t i, size_t j) const;
+
+        /**
+         * Multiplication in the field
+         * @param i field element in <code>0..q-1</code>
+         * @param j field element in <code>0..q-1</code>
+         * @return the field element <code>i * j</code>
+         */
+        int times(size_t i, size_t j) const;
+
+        /**
+         * Get the full addition table of the field
+         * @return matrix of dimension u_q x u_q
+         */
+        bclib::matrix<int> getPlusTable() const;
+
+        /**
+         * Get the full multiplication table of the field
+         * @return matrix of dimension u_q x u_q
+         */
+        bclib::matrix<int> getTimesTable() const;
+
         /**
          * Multiplication in polynomial representation
          *
+         * Products in GF(2^n) with <code>n <= GF_CLMUL_MAX_N</code> are computed
+         * with <code>binaryPolyProd</code>.
+         *
          * @param p modulus
          * @param u_n length of p1 and p2
          * @param xton characteristic polynomial
@@ -91,6 +172,22 @@ namespace oacpp {
          * @param sum the sum of the polynomials
          */
         static void polySum(int p, size_t u_n, const std::vector<int> & p1, const std::vector<int> & p2, std::vector<int> & sum);
+
+        /**
+         * Carry-less multiplication in GF(2^n) with each polynomial packed in a word
+         *
+         * Bit i holds the coefficient of x^i.  The product uses the PCLMUL
+         * instruction when the processor has it and shift and XOR otherwise.
+         *
+         * @param a polynomial 1
+         * @param b polynomial 2
+         * @param u_n the degree of the field extension, at most <code>GF_CLMUL_MAX_N</code>
+         * @param reduction the packed characteristic polynomial <code>xton</code>
+         * @return the packed product
+         */
+        static unsigned long long binaryPolyProd(unsigned long long a, unsigned long long b,
+            size_t u_n, unsigned long long reduction);
+
         /**
          * Convert polynomial to integer in <code>0..q-1</code>
          *
@@ -101,11 +198,83 @@ namespace oacpp {
          */
         static int poly2int(int p, int n, const std::vector<int> & poly);
 
+        /**
+         * Approximate memory used by the field tables
+         * @return the number of bytes
+         */
+        size_t getMemoryBytes() const;
+
         /**
          * Print a Galois field
          */
         void print();
     };
+
+    inline
+    int GaloisField::addElements(size_t i, size_t j) const
+    {
+        if (i == 0)
+        {
+            return static_cast<int>(j);
+        }
+        if (j == 0)
+        {
+            return static_cast<int>(i);
+        }
+        if (p == 2)
+        {
+            // the coefficients of x^k are the bits of the element
+            return static_cast<int>(i ^ j);
+        }
+        // a^r + a^s = a^r * (1 + a^(s-r))
+        size_t qm1 = u_q - 1;
+        size_t logi = static_cast<size_t>(logs[i]);
+        size_t diff = static_cast<size_t>(logs[j]) + qm1 - logi;
+        diff = (diff >= qm1) ? diff - qm1 : diff;
+        int z = zech[diff];
+        if (z < 0)
+        {
+            return 0;
+        }
+        size_t e = logi + static_cast<size_t>(z);
+        return antilogs[(e >= qm1) ? e - qm1 : e];
+    }
+
+    inline
+    int GaloisField::multiplyElements(size_t i, size_t j) const
+    {
+        if (i == 0 || j == 0)
+        {
+            return 0;
+        }
+        size_t qm1 = u_q - 1;
+        size_t e = static_cast<size_t>(logs[i]) + static_cast<size_t>(logs[j]);
+        return antilogs[(e >= qm1) ? e - qm1 : e];
+    }
+
+    inline
+    int GaloisField::plus(size_t i, size_t j) const
+    {
+#ifdef RANGE_DEBUG
+        if (i >= u_q || j >= u_q)
+        {
+            throw std::out_of_range("Galois field element out of range");
+        }
+#endif
+        return m_plus.isEmpty() ? addElements(i, j) : m_plus(i, j);
+    }
+
+    inline
+    int GaloisField::times(size_t i, size_t j) const
+    {
+#ifdef RANGE_DEBUG
+        if (i >= u_q || j >= u_q)
+        {
+            throw std::out_of_range("Galois field element out of range");
+        }
+#endif
+        return m_times.isEmpty() ? multiplyElements(i, j) : m_times(i, j);
+    }
 } // end namespace
 
 #endif
@@ -0,0 +1,138 @@
+/**
+ * @file GaloisFieldCache.cpp
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License:  MIT
+ *
+ * Reference:
+ * <ul><li><a href="http://lib.stat.cmu.edu/designs/">Statlib Designs</a></li>
+ * <li><a href="http://lib.stat.cmu.edu/designs/oa.c">Owen's Orthogonal Array Algorithms</a></li></ul>
+ *
+ */
+
+#include "GaloisFieldCache.h"
+
+namespace oacpp
+{
+    GaloisFieldCache::CacheState & GaloisFieldCache::state()
+    {
+        // function local statics are initialized once in a thread-safe way
+        static CacheState cs;
+        return cs;
+    }
+
+    std::shared_ptr<const GaloisField> GaloisFieldCache::getField(int q)
+    {
+        CacheState & cs = state();
+        {
+            std::lock_guard<std::mutex> guard(cs.lock);
+            std::map<int, CacheEntry>::iterator it = cs.fields.find(q);
+            if (it != cs.fields.end())
+            {
+                cs.usage.splice(cs.usage.begin(), cs.usage, it->second.usage);
+                cs.hits++;
+                return it->second.field;
+            }
+        }
+
+        // construct outside of the lock so that other fields can be served meanwhile
+        std::shared_ptr<const GaloisField> field = std::make_shared<GaloisField>(q);
+        size_t bytes = field->getMemoryBytes();
+
+        std::lock_guard<std::mutex> guard(cs.lock);
+        std::map<int, CacheEntry>::iterator it = cs.fields.find(q);
+        if (it != cs.fields.end())
+        {
+            // another thread constructed the same field first
+            cs.usage.splice(cs.usage.begin(), cs.usage, it->second.usage);
+            cs.hits++;
+            return it->second.field;
+        }
+        cs.misses++;
+        if (bytes > cs.bytesLimit)
+        {
+            return field;
+        }
+        cs.usage.push_front(q);
+        CacheEntry entry;
+        entry.field = field;
+        entry.usage = cs.usage.begin();
+        entry.bytes = bytes;
+        cs.fields[q] = entry;
+        cs.bytesUsed += bytes;
+        evict(cs);
+        return field;
+    }
+
+    void GaloisFieldCache::evict(CacheState & cs)
+    {
+        while (cs.bytesUsed > cs.bytesLimit && !cs.usage.empty())
+        {
+            int q = cs.usage.back();
+            cs.usage.pop_back();
+            std::map<int, CacheEntry>::iterator it = cs.fields.find(q);
+            cs.bytesUsed -= it->second.bytes;
+            cs.fields.erase(it);
+        }
+    }
+
+    void GaloisFieldCache::setMemoryLimit(size_t bytes)
+    {
+        CacheState & cs = state();
+        std::lock_guard<std::mutex> guard(cs.lock);
+        cs.bytesLimit = bytes;
+        evict(cs);
+    }
+
+    size_t GaloisFieldCache::getMemoryLimit()
+    {
+        CacheState & cs = state();
+        std::lock_guard<std::mutex> guard(cs.lock);
+        return cs.bytesLimit;
+    }
+
+    size_t GaloisFieldCache::getMemoryUsed()
+    {
+        CacheState & cs = state();
+        std::lock_guard<std::mutex> guard(cs.lock);
+        return cs.bytesUsed;
+    }
+
+    size_t GaloisFieldCache::size()
+    {
+        CacheState & cs = state();
+        std::lock_guard<std::mutex> guard(cs.lock);
+        return cs.fields.size();
+    }
+
+    std::vector<int> GaloisFieldCache::getCachedOrders()
+    {
+        CacheState & cs = state();
+        std::lock_guard<std::mutex> guard(cs.lock);
+        return std::vector<int>(cs.usage.begin(), cs.usage.end());
+    }
+
+    size_t GaloisFieldCache::getHits()
+    {
+        CacheState & cs = state();
+        std::lock_guard<std::mutex> guard(cs.lock);
+        return cs.hits;
+    }
+
+    size_t GaloisFieldCache::getMisses()
+    {
+        CacheState & cs = state();
+        std::lock_guard<std::mutex> guard(cs.lock);
+        return cs.misses;
+    }
+
+    void GaloisFieldCache::clear()
+    {
+        CacheState & cs = state();
+        std::lock_guard<std::mutex> guard(cs.lock);
+        cs.fields.clear();
+        cs.usage.clear();
+        cs.bytesUsed = 0;
+    }
+} // end namespace
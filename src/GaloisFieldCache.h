@@ -0,0 +1,146 @@
+/**
+ * @file GaloisFieldCache.h
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License:  MIT
+ *
+ * Reference:
+ * <ul><li><a href="http://lib.stat.cmu.edu/designs/">Statlib Designs</a></li>
+ * <li><a href="http://lib.stat.cmu.edu/designs/oa.c">Owen's Orthogonal Array Algorithms</a></li></ul>
+ *
+ */
+
+#ifndef GALOISFIELDCACHE_H
+#define GALOISFIELDCACHE_H
+
+#include "OACommonDefines.h"
+#include "GaloisField.h"
+#include <memory>
+#include <mutex>
+#include <map>
+#include <list>
+#include <vector>
+
+/**
+ * The default memory bound of the Galois field cache in bytes
+ */
+#define GF_CACHE_DEFAULT_BYTES 67108864
+
+namespace oacpp {
+    /**
+     * Process-wide cache of constructed Galois fields keyed by the order q
+     *
+     * The fields are immutable once constructed and are shared between
+     * callers.  Access is thread-safe.  When the memory used by the cached
+     * fields exceeds the bound, the least recently used fields are released
+     * from the cache.  Callers that still hold a field keep it alive.
+     */
+    class GaloisFieldCache
+    {
+    public:
+        /**
+         * Get the Galois field of order q, constructing it if it is not cached
+         * @param q the order of the field q = p^n
+         * @return a shared pointer to the field
+         * @throws std::runtime_error if the field cannot be constructed
+         */
+        static std::shared_ptr<const GaloisField> getField(int q);
+
+        /**
+         * Set the memory bound of the cache
+         * @note fields larger than the bound are constructed but not cached
+         * @param bytes the maximum number of bytes held by the cached fields
+         */
+        static void setMemoryLimit(size_t bytes);
+
+        /**
+         * Get the memory bound of the cache
+         * @return the maximum number of bytes held by the cached fields
+         */
+        static size_t getMemoryLimit();
+
+        /**
+         * Get the memory used by the cached fields
+         * @return the number of bytes held by the cached fields
+         */
+        static size_t getMemoryUsed();
+
+        /**
+         * Get the number of cached fields
+         * @return the number of fields
+         */
+        static size_t size();
+
+        /**
+         * Get the orders of the cached fields
+         * @return the q of each cached field from the most to the least recently used
+         */
+        static std::vector<int> getCachedOrders();
+
+        /**
+         * Get the number of requests served from the cache
+         * @return the number of hits since the process started
+         */
+        static size_t getHits();
+
+        /**
+         * Get the number of requests that constructed a field
+         * @return the number of misses since the process started
+         */
+        static size_t getMisses();
+
+        /**
+         * Release all fields from the cache
+         */
+        static void clear();
+
+    private:
+        /** cached field and its position in the least recently used list */
+        struct CacheEntry
+        {
+            /** the cached field */
+            std::shared_ptr<const GaloisField> field;
+            /** the position of q in the usage list */
+            std::list<int>::iterator usage;
+            /** the memory used by the field */
+            size_t bytes;
+        };
+
+        /** shared state of the cache */
+        struct CacheState
+        {
+            /** protects all members */
+            std::mutex lock;
+            /** cached fields keyed by q */
+            std::map<int, CacheEntry> fields;
+            /** q values ordered from most to least recently used */
+            std::list<int> usage;
+            /** memory used by the cached fields */
+            size_t bytesUsed;
+            /** memory bound of the cache */
+            size_t bytesLimit;
+            /** requests served from the cache */
+            size_t hits;
+            /** requests that constructed a field */
+            size_t misses;
+
+            CacheState() : bytesUsed(0), bytesLimit(GF_CACHE_DEFAULT_BYTES), hits(0), misses(0) {}
+        };
+
+        /**
+         * Get the shared state of the cache
+         * @return the state
+         */
+        static CacheState & state();
+
+        /**
+         * Release least recently used fields until the memory bound is met
+         * @note the caller must hold the lock
+         * @param cs the cache state
+         */
+        static void evict(CacheState & cs);
+    };
+} // end namespace
+
+#endif
@@ -35,6 +35,7 @@
 #include "matrix.h"
 #include "order.h"
 #include "CRandom.h"
+#include "RunStatistics.h"
 
 #ifdef RCOMPILE
 #include <Rcpp.h>
@@ -50,6 +51,18 @@
 /** Should results be printed */
 #define PRINT_RESULT 0
 
+/** The largest number of integer squared distances tabulated by lhslib::InverseDistanceTable */
+#define LHS_DISTANCE_TABLE_MAX 1048576
+
+/** The size in bytes of one tile of points in the blocked all-pairs distances.  A pair of tiles fits in a typical L2 cache */
+#define LHS_DISTANCE_TILE_BYTES 65536
+
+/** Designs with at least this many rows use the blocked all-pairs distances for the full criteria */
+#define LHS_DISTANCE_BLOCKED_MIN_ROWS 2048
+
+/** The minimum number of tile rows of the blocked all-pairs distances computed by each thread */
+#define LHS_DISTANCE_MIN_TILES_PER_THREAD 2
+
 /** RNG Macro (See lhs_r.cpp)*/
 #define START_RNG Rcpp::RNGScope * tempRNG = new Rcpp::RNGScope(); // instantiate a pointer so that the destructor is not implicitly called
 /** End RNG Macro (See lhs_r.cpp)*/
@@ -65,21 +78,53 @@ namespace lhslib
      * @param n number of rows / samples in the lha
      * @param k number parameters / columns in the lhs
      * @param dup A factor that determines the number of candidate points used in the search.
-     * @param result the result matrix
+     * @param result the n x k result matrix, transposed or not
      * @param oRandom the random number stream
      */
     void improvedLHS(int n, int k, int dup, bclib::matrix<int> & result,
             bclib::CRandom<double> & oRandom);
+    /**
+     * Improved Latin hypercube sample algorithm with run statistics
+     *
+     * Each point added to the sample is an accepted move.  The candidates are
+     * the points it is chosen from, every distance from a candidate to a point
+     * already in the sample is a criterion evaluation, and the trajectory is
+     * the distance of each chosen point from the optimum spacing.
+     *
+     * @param n number of rows / samples in the lha
+     * @param k number parameters / columns in the lhs
+     * @param dup A factor that determines the number of candidate points used in the search.
+     * @param result the n x k result matrix, transposed or not
+     * @param oRandom the random number stream
+     * @param stats the statistics of the run, or <code>NULL</code>
+     */
+    void improvedLHS(int n, int k, int dup, bclib::matrix<int> & result,
+            bclib::CRandom<double> & oRandom, bclib::RunStatistics * stats);
     /**
      * Latin hypercube sample algorithm with maximin criterion
      * @param n number of rows / samples in the lha
      * @param k number parameters / columns in the lhs
      * @param dup A factor that determines the number of candidate points used in the search.
-     * @param result the result matrix
+     * @param result the n x k result matrix, transposed or not
      * @param oRandom the random number stream
      */
     void maximinLHS(int n, int k, int dup, bclib::matrix<int> & result,
             bclib::CRandom<double> & oRandom);
+    /**
+     * Latin hypercube sample algorithm with maximin criterion with run statistics
+     *
+     * The statistics are counted as in <code>improvedLHS</code>, and the
+     * trajectory is the squared minimum distance of each chosen point.
+     *
+     * @param n number of rows / samples in the lha
+     * @param k number parameters / columns in the lhs
+     * @param dup A factor that determines the number of candidate points used in the search.
+     * @param result the n x k result matrix, transposed or not
+     * @param oRandom the random number stream
+     * @param stats the statistics of the run, or <code>NULL</code>
+     */
+    void maximinLHS(int n, int k, int dup, bclib::matrix<int> & result,
+            bclib::CRandom<double> & oRandom, bclib::RunStatistics * stats);
     /**
      * Optimum Latin hypercube sample algorithm
      * @param n number of rows / samples in the lha
@@ -94,6 +139,27 @@ namespace lhslib
     void optimumLHS(int n, int k, int maxSweeps, double eps,
             bclib::matrix<int> & outlhs, int optimalityRecordLength,
             bclib::CRandom<double> & oRandom, bool bVerbose);
+    /**
+     * Optimum Latin hypercube sample algorithm with run statistics
+     *
+     * Every row interchange tried is a candidate and a criterion evaluation,
+     * the best interchange of a column that improves the design is an accepted
+     * move, and the trajectory is the criterion at the start and after each
+     * column.
+     *
+     * @param n number of rows / samples in the lha
+     * @param k number parameters / columns in the lhs
+     * @param maxSweeps the maximum number of sweeps to use in the algorithm
+     * @param eps The optimal stopping criterion
+     * @param outlhs the resultant lhs
+     * @param optimalityRecordLength the length of a vector used in the calculations
+     * @param oRandom the random number stream
+     * @param bVerbose should messages be printed?
+     * @param stats the statistics of the run, or <code>NULL</code>
+     */
+    void optimumLHS(int n, int k, int maxSweeps, double eps,
+            bclib::matrix<int> & outlhs, int optimalityRecordLength,
+            bclib::CRandom<double> & oRandom, bool bVerbose, bclib::RunStatistics * stats);
     /**
      * Application of the optimum lhs method to a seeded Latin hypercube
      * @param n number of rows / samples in the lhs
@@ -106,6 +172,23 @@ namespace lhslib
      */
     void optSeededLHS(int n, int k, int maxSweeps, double eps,
             bclib::matrix<double> & oldHypercube, int optimalityRecordLength, bool bVerbose);
+    /**
+     * Application of the optimum lhs method to a seeded Latin hypercube with run statistics
+     *
+     * The statistics are counted as in <code>optimumLHS</code>.
+     *
+     * @param n number of rows / samples in the lhs
+     * @param k number parameters / columns in the lhs
+     * @param maxSweeps the maximum number of sweeps to use in the algorithm
+     * @param eps The optimal stopping criterion
+     * @param oldHypercube the seeded lhs
+     * @param optimalityRecordLength the length of a vector used in the calculations
+     * @param bVerbose should messages be printed?
+     * @param stats the statistics of the run, or <code>NULL</code>
+     */
+    void optSeededLHS(int n, int k, int maxSweeps, double eps,
+            bclib::matrix<double> & oldHypercube, int optimalityRecordLength, bool bVerbose,
+            bclib::RunStatistics * stats);
 
     /**
      * type of size type for use with bclib::matrix<T>
@@ -151,6 +234,28 @@ namespace lhslib
      */
     void geneticLHS(int n, int k, int pop, int gen, double pMut, const std::string & criterium,
             bool bVerbose, bclib::matrix<double> & result, bclib::CRandom<double> & oRandom);
+
+    /**
+     * Create a latin hypercube sample optimized by a genetic algorithm with run statistics
+     *
+     * Every member of every generation is a candidate and a criterion
+     * evaluation, every mutation applied is an accepted move, and the
+     * trajectory is the best criterion of each generation.
+     *
+     * @param n number of rows / samples in the lhs
+     * @param k number parameters / columns in the lhs
+     * @param pop the population of the genetic algorithm in each iteration
+     * @param gen the number of generations to use
+     * @param pMut the mutation rate
+     * @param criterium the optimization criterium
+     * @param bVerbose should messages be printed?
+     * @param result the lhs
+     * @param oRandom the random number stream
+     * @param stats the statistics of the run, or <code>NULL</code>
+     */
+    void geneticLHS(int n, int k, int pop, int gen, double pMut, const std::string & criterium,
+            bool bVerbose, bclib::matrix<double> & result, bclib::CRandom<double> & oRandom,
+            bclib::RunStatistics * stats);
 }
 
 #endif	/* LHSCOMMONDEFINES_H */
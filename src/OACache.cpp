@@ -0,0 +1,240 @@
+/**
+ * @file OACache.cpp
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License:  MIT
+ *
+ * Reference:
+ * <ul><li><a href="http://lib.stat.cmu.edu/designs/">Statlib Designs</a></li>
+ * <li><a href="http://lib.stat.cmu.edu/designs/oa.c">Owen's Orthogonal Array Algorithms</a></li></ul>
+ *
+ */
+
+#include "OACache.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define OA_CACHE_MKSTEMP
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <process.h>
+#endif
+
+/** the first bytes of every cache file, the last digits are the file format version */
+static const char OA_CACHE_MAGIC[8] = {'L', 'H', 'S', 'O', 'A', '0', '0', '2'};
+
+namespace oacpp
+{
+    OACache::CacheState & OACache::state()
+    {
+        // function local statics are initialized once in a thread-safe way
+        static CacheState cs;
+        return cs;
+    }
+
+    void OACache::setDirectory(const std::string & directory)
+    {
+        CacheState & cs = state();
+        std::lock_guard<std::mutex> guard(cs.lock);
+        cs.directory = directory;
+    }
+
+    std::string OACache::getDirectory()
+    {
+        CacheState & cs = state();
+        std::lock_guard<std::mutex> guard(cs.lock);
+        return cs.directory;
+    }
+
+    bool OACache::isEnabled()
+    {
+        return !getDirectory().empty();
+    }
+
+    std::string OACache::makeKey(const std::string & type, int q, int param, int ncol)
+    {
+        std::ostringstream key;
+        key << "oacpp " << getVersion() << " " << type << " q=" << q << " param=" << param << " ncol=" << ncol;
+        return key.str();
+    }
+
+    unsigned long long OACache::hash(const char * data, size_t bytes)
+    {
+        unsigned long long h = 14695981039346656037ULL;
+        for (size_t i = 0; i < bytes; i++)
+        {
+            h ^= static_cast<unsigned char>(data[i]);
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+    unsigned long long OACache::hash(const std::string & s)
+    {
+        return hash(s.data(), s.size());
+    }
+
+    std::string OACache::getPath(const std::string & key)
+    {
+        std::string directory = getDirectory();
+        if (directory.empty())
+        {
+            return "";
+        }
+        char name[24];
+        std::snprintf(name, sizeof(name), "%016llx.oa", hash(key));
+        char last = directory[directory.size() - 1];
+        if (last != '/' && last != '\\')
+        {
+            directory += "/";
+        }
+        return directory + name;
+    }
+
+    bool OACache::readImage(const char * image, size_t bytes, const std::string & key,
+        size_t nrow, size_t ncol, bclib::matrix<int> & A)
+    {
+        size_t header = sizeof(OA_CACHE_MAGIC) + sizeof(uint32_t) + key.size() + 2 * sizeof(int32_t);
+        size_t valueBytes = nrow * ncol * sizeof(int32_t);
+        if (bytes != header + valueBytes + sizeof(uint64_t) ||
+                std::memcmp(image, OA_CACHE_MAGIC, sizeof(OA_CACHE_MAGIC)) != 0)
+        {
+            return false;
+        }
+        const char * pos = image + sizeof(OA_CACHE_MAGIC);
+        uint32_t keyLength;
+        std::memcpy(&keyLength, pos, sizeof(uint32_t));
+        pos += sizeof(uint32_t);
+        // the hash names the file, the stored key guards against collisions
+        if (keyLength != key.size() || std::memcmp(pos, key.data(), key.size()) != 0)
+        {
+            return false;
+        }
+        pos += key.size();
+        int32_t dims[2];
+        std::memcpy(dims, pos, sizeof(dims));
+        pos += sizeof(dims);
+        if (static_cast<size_t>(dims[0]) != nrow || static_cast<size_t>(dims[1]) != ncol)
+        {
+            return false;
+        }
+        // a damaged file with the right size is caught by the checksum of the elements
+        uint64_t checksum;
+        std::memcpy(&checksum, pos + valueBytes, sizeof(uint64_t));
+        if (checksum != hash(pos, valueBytes))
+        {
+            return false;
+        }
+        A = bclib::matrix<int>(nrow, ncol);
+        std::memcpy(A.data(), pos, valueBytes);
+        return true;
+    }
+
+    bool OACache::load(const std::string & key, size_t nrow, size_t ncol, bclib::matrix<int> & A)
+    {
+        std::string path = getPath(key);
+        if (path.empty() || nrow == 0 || ncol == 0)
+        {
+            return false;
+        }
+        std::ifstream in(path.c_str(), std::ios::binary | std::ios::ate);
+        if (!in)
+        {
+            return false;
+        }
+        std::streamoff bytes = in.tellg();
+        if (bytes <= 0)
+        {
+            return false;
+        }
+        std::vector<char> image(static_cast<size_t>(bytes));
+        in.seekg(0);
+        if (!in.read(image.data(), bytes))
+        {
+            return false;
+        }
+        return readImage(image.data(), image.size(), key, nrow, ncol, A);
+    }
+
+    std::FILE * OACache::createTempFile(const std::string & path, std::string & tempPath)
+    {
+#ifdef OA_CACHE_MKSTEMP
+        // mkstemp creates a new file with a unique name, so writers in forked
+        // processes, which share thread ids and counters, never share a file
+        std::string pattern = path + ".tmpXXXXXX";
+        std::vector<char> name(pattern.begin(), pattern.end());
+        name.push_back('\0');
+        int fd = mkstemp(name.data());
+        if (fd < 0)
+        {
+            return NULL;
+        }
+        tempPath = name.data();
+        std::FILE * out = fdopen(fd, "wb");
+        if (out == NULL)
+        {
+            close(fd);
+            std::remove(tempPath.c_str());
+        }
+        return out;
+#else
+        std::ostringstream name;
+        name << path << ".tmp";
+#ifdef _WIN32
+        name << _getpid() << ".";
+#endif
+        name << std::hash<std::thread::id>()(std::this_thread::get_id()) << "." << state().writes++;
+        tempPath = name.str();
+        return std::fopen(tempPath.c_str(), "wb");
+#endif
+    }
+
+    bool OACache::store(const std::string & key, const bclib::matrix<int> & A)
+    {
+        std::string path = getPath(key);
+        if (path.empty() || A.isEmpty())
+        {
+            return false;
+        }
+        size_t nrow = A.rowsize();
+        size_t ncol = A.colsize();
+        uint32_t keyLength = static_cast<uint32_t>(key.size());
+        int32_t dims[2] = {static_cast<int32_t>(nrow), static_cast<int32_t>(ncol)};
+        std::vector<int32_t> values(nrow * ncol);
+        for (size_t i = 0; i < nrow; i++)
+        {
+            for (size_t j = 0; j < ncol; j++)
+            {
+                values[i * ncol + j] = static_cast<int32_t>(A(i, j));
+            }
+        }
+
+        // write to a file created for this writer alone, then move it into place
+        std::string tempPath;
+        std::FILE * out = createTempFile(path, tempPath);
+        if (out == NULL)
+        {
+            return false;
+        }
+        size_t valueBytes = values.size() * sizeof(int32_t);
+        uint64_t checksum = hash(reinterpret_cast<const char *>(values.data()), valueBytes);
+        bool bWritten = std::fwrite(OA_CACHE_MAGIC, sizeof(OA_CACHE_MAGIC), 1, out) == 1 &&
+            std::fwrite(&keyLength, sizeof(keyLength), 1, out) == 1 &&
+            std::fwrite(key.data(), 1, key.size(), out) == key.size() &&
+            std::fwrite(dims, sizeof(dims), 1, out) == 1 &&
+            std::fwrite(values.data(), 1, valueBytes, out) == valueBytes &&
+            std::fwrite(&checksum, sizeof(checksum), 1, out) == 1;
+        if (std::fclose(out) != 0 || !bWritten)
+        {
+            std::remove(tempPath.c_str());
+            return false;
+        }
+        if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+        {
+            // another writer may have placed the same array first
+            std::remove(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+} // end namespace
@@ -0,0 +1,178 @@
+/**
+ * @file OACache.h
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License:  MIT
+ *
+ * Reference:
+ * <ul><li><a href="http://lib.stat.cmu.edu/designs/">Statlib Designs</a></li>
+ * <li><a href="http://lib.stat.cmu.edu/designs/oa.c">Owen's Orthogonal Array Algorithms</a></li></ul>
+ *
+ */
+
+#ifndef OACACHE_H
+#define OACACHE_H
+
+#include "OACommonDefines.h"
+#include "oalibVersion.h"
+#include "matrix.h"
+#include <mutex>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+
+/**
+ * The environment variable that enables the on-disk orthogonal array cache
+ */
+#define OA_CACHE_DIR_ENV "LHS_OA_CACHE_DIR"
+
+namespace oacpp {
+    /**
+     * Process-wide on-disk cache of constructed orthogonal arrays
+     *
+     * The algebraic constructions are deterministic functions of the
+     * construction, q, the construction parameter, and the number of columns,
+     * so an array built once can be reused by later processes.  The cache is
+     * disabled until a directory is set with <code>setDirectory</code> or
+     * through the <code>LHS_OA_CACHE_DIR</code> environment variable.
+     *
+     * Each array is stored in its own file named by a hash of its key.  The
+     * key includes the library version from <code>oalibVersion.h</code> so
+     * that arrays written by other versions are never read.  A file holds a
+     * magic string, the key, the dimensions, the row-major elements as
+     * native 32-bit integers, and a 64-bit FNV-1a checksum of the elements.
+     *
+     * The cache is best effort: unreadable, corrupt, or mismatched files are
+     * treated as misses and write failures are ignored.  Files are written to
+     * a temporary file unique to the writer, including writers in forked
+     * processes, and renamed so that readers never see partial arrays.
+     */
+    class OACache
+    {
+    public:
+        /**
+         * Set the cache directory
+         * @param directory an existing writable directory, or an empty string to disable the cache
+         */
+        static void setDirectory(const std::string & directory);
+
+        /**
+         * Get the cache directory
+         * @return the directory, or an empty string if the cache is disabled
+         */
+        static std::string getDirectory();
+
+        /**
+         * Is the cache enabled
+         * @return true if a cache directory is set
+         */
+        static bool isEnabled();
+
+        /**
+         * Build the key of an orthogonal array
+         * @param type the construction, for example <code>bose</code> or <code>busht</code>
+         * @param q the number of levels
+         * @param param the construction parameter, for example the strength or lambda, otherwise 0
+         * @param ncol the number of columns
+         * @return the key
+         */
+        static std::string makeKey(const std::string & type, int q, int param, int ncol);
+
+        /**
+         * Get the path of the cache file for a key
+         * @param key the array key from <code>makeKey</code>
+         * @return the path, or an empty string if the cache is disabled
+         */
+        static std::string getPath(const std::string & key);
+
+        /**
+         * Load an orthogonal array from the cache
+         * @param key the array key from <code>makeKey</code>
+         * @param nrow the expected number of rows
+         * @param ncol the expected number of columns
+         * @param A the array, only changed on a hit
+         * @return true if the array was found
+         */
+        static bool load(const std::string & key, size_t nrow, size_t ncol, bclib::matrix<int> & A);
+
+        /**
+         * Store an orthogonal array in the cache
+         * @param key the array key from <code>makeKey</code>
+         * @param A the array
+         * @return true if the array was written
+         */
+        static bool store(const std::string & key, const bclib::matrix<int> & A);
+
+    private:
+        /** shared state of the cache */
+        struct CacheState
+        {
+            /** protects all members */
+            std::mutex lock;
+            /** the cache directory, empty if disabled */
+            std::string directory;
+            /** distinguishes the temporary files written by this process */
+            std::atomic<unsigned long long> writes;
+
+            CacheState() : writes(0)
+            {
+                const char * env = std::getenv(OA_CACHE_DIR_ENV);
+                directory = (env == NULL) ? "" : std::string(env);
+            }
+        };
+
+        /**
+         * Get the shared state of the cache
+         * @return the state
+         */
+        static CacheState & state();
+
+        /**
+         * 64 bit FNV-1a hash
+         * @param data the bytes to hash
+         * @param bytes the number of bytes
+         * @return the hash
+         */
+        static unsigned long long hash(const char * data, size_t bytes);
+
+        /**
+         * 64 bit FNV-1a hash
+         * @param s the string to hash
+         * @return the hash
+         */
+        static unsigned long long hash(const std::string & s);
+
+        /**
+         * Create a temporary file next to a cache file for one writer
+         *
+         * The file is created with <code>mkstemp</code> where it is available,
+         * otherwise the name includes the process id, the thread id, and a count
+         * of the writes of this process.
+         *
+         * @param path the path of the cache file
+         * @param tempPath the path of the temporary file on return
+         * @return the open file, or NULL if it could not be created
+         */
+        static std::FILE * createTempFile(const std::string & path, std::string & tempPath);
+
+        /**
+         * Check a cache file image and copy the array out of it
+         * @param image the file contents
+         * @param bytes the file size
+         * @param key the expected key
+         * @param nrow the expected number of rows
+         * @param ncol the expected number of columns
+         * @param A the array, only changed if the image matches and its checksum is correct
+         * @return true if the image matches
+         */
+        static bool readImage(const char * image, size_t bytes, const std::string & key,
+            size_t nrow, size_t ncol, bclib::matrix<int> & A);
+    };
+} // end namespace
+
+#endif
@@ -85,6 +85,11 @@
  */
 #define WARNING_CHECK 2
 
+/**
+ * The minimum number of orthogonal array rows computed by each thread
+ */
+#define OA_MIN_ROWS_PER_THREAD 4096
+
 namespace oacpp {
 	/**
 	 * throw a runtime_error with a stringstream message
@@ -342,7 +347,15 @@ namespace oacpp {
  * published references.  The rules have not all
  * been checked for accuracy, because some of the fields are
  * very large (e.g. 16807 elements).
+ * </blockquote>
+ *
+ * In this library, the full addition and multiplication tables are only kept for
+ * fields with at most <code>GF_FULL_TABLE_MAX</code> elements.  Larger fields store the
+ * log and antilog tables of a primitive element and the Zech logarithms, so that
+ * they need <code>O(q)</code> memory.  Addition in fields of characteristic 2 is an
+ * exclusive or of the element indices.
  *
+ * <blockquote>
  * The functions that manipulate orthogonal arrays
  * keep the arrays in integer matrices.  This might be
  * a problem for applications that require enormous
@@ -0,0 +1,568 @@
+/**
+ * @file OARowGenerator.cpp
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License:  This file may be freely used and shared according to the original license.
+ *
+ * Reference:
+ * <ul><li><a href="http://lib.stat.cmu.edu/designs/">Statlib Designs</a></li>
+ * <li><a href="http://lib.stat.cmu.edu/designs/oa.c">Owen's Orthogonal Array Algorithms</a></li></ul>
+ *
+ * Original Header:
+ * <blockquote>
+ * These programs construct and manipulate orthogonal arrays.  They were prepared by
+ *
+ * - Art Owen
+ * - Department of Statistics
+ * - Sequoia Hall
+ * - Stanford CA 94305
+ *
+ * They may be freely used and shared.  This code comes
+ * with no warranty of any kind.  Use it at your own
+ * risk.
+ *
+ * I thank the Semiconductor Research Corporation and
+ * the National Science Foundation for supporting this
+ * work.
+ * </blockquote>
+ */
+
+#include "OARowGenerator.h"
+
+namespace oacpp
+{
+    OARowGenerator::OARowGenerator(const GaloisField & gf, size_t nrow, size_t ncol)
+        : m_gf(gf), m_nrow(nrow), m_ncol(ncol)
+    {
+    }
+
+    void OARowGenerator::getRow(size_t row, std::vector<int> & values) const
+    {
+        if (row >= m_nrow)
+        {
+            throw std::out_of_range("Row index out of range for the orthogonal array");
+        }
+        values.resize(m_ncol);
+        std::vector<int> scratch(getScratchSize());
+        computeRow(row, values.data(), scratch);
+    }
+
+    void OARowGenerator::getRows(size_t firstRow, bclib::matrix<int> & block) const
+    {
+        if (firstRow + block.rowsize() > m_nrow || block.colsize() < m_ncol)
+        {
+            throw std::out_of_range("Row block out of range for the orthogonal array");
+        }
+        std::vector<int> values(m_ncol);
+        std::vector<int> scratch(getScratchSize());
+        for (size_t i = 0; i < block.rowsize(); i++)
+        {
+            computeRow(firstRow + i, values.data(), scratch);
+            for (size_t j = 0; j < m_ncol; j++)
+            {
+                block(i, j) = values[j];
+            }
+        }
+    }
+
+    void OARowGenerator::fill(bclib::matrix<int> & A) const
+    {
+        fill(A, bclib::threadsForWork(m_nrow, OA_MIN_ROWS_PER_THREAD));
+    }
+
+    void OARowGenerator::fill(bclib::matrix<int> & A, unsigned int nthreads) const
+    {
+        if (A.rowsize() < m_nrow || A.colsize() < m_ncol)
+        {
+            throw std::out_of_range("Matrix too small for the orthogonal array");
+        }
+        // each thread computes a contiguous range of rows so the writes to A are disjoint
+        bclib::parallelForRange(m_nrow, nthreads, [this, &A](size_t firstRow, size_t lastRow)
+        {
+            fillRange(A, firstRow, lastRow);
+        });
+    }
+
+    void OARowGenerator::fillRange(bclib::matrix<int> & A, size_t firstRow, size_t lastRow) const
+    {
+        std::vector<int> values(m_ncol);
+        std::vector<int> scratch(getScratchSize());
+        for (size_t i = firstRow; i < lastRow; i++)
+        {
+            computeRow(i, values.data(), scratch);
+            for (size_t j = 0; j < m_ncol; j++)
+            {
+                A(i, j) = values[j];
+            }
+        }
+    }
+
+    BoseRowGenerator::BoseRowGenerator(const GaloisField & gf, int ncol)
+        : OARowGenerator(gf, gf.u_q * gf.u_q, static_cast<size_t>(ncol))
+    {
+        // bosecheck throws if it fails
+        oaconstruct::bosecheck(gf.q, ncol);
+    }
+
+    void BoseRowGenerator::computeRow(size_t row, int * values, std::vector<int> & /*scratch*/) const
+    {
+        size_t i = row / m_gf.u_q;
+        size_t j = row % m_gf.u_q;
+
+        values[0] = static_cast<int>(i);
+        if (m_ncol > 1)
+        {
+            values[1] = static_cast<int>(j);
+        }
+        for (size_t icol = 2; icol < m_ncol; icol++)
+        {
+            values[icol] = m_gf.plus(j, m_gf.times(i, icol - 1));
+        }
+    }
+
+    BushRowGenerator::BushRowGenerator(const GaloisField & gf, int str, int ncol)
+        : OARowGenerator(gf, static_cast<size_t>(primes::ipow(gf.q, str)), static_cast<size_t>(ncol)),
+        m_str(str)
+    {
+        // bushcheck throws if it fails
+        oaconstruct::bushcheck(gf.q, str, ncol);
+    }
+
+    size_t BushRowGenerator::getScratchSize() const
+    {
+        return static_cast<size_t>(m_str);
+    }
+
+    void BushRowGenerator::computeRow(size_t row, int * values, std::vector<int> & scratch) const
+    {
+        // the coefficients of the polynomial of the row
+        std::vector<int> & coef = scratch;
+
+        oaconstruct::itopoly(static_cast<int>(row), m_gf.q, m_str - 1, coef);
+        values[0] = coef[static_cast<size_t>(m_str) - 1];
+        for (size_t j = 0; j < m_ncol - 1; j++)
+        {
+            oaconstruct::polyeval(m_gf, m_str - 1, coef, static_cast<int>(j), &(values[1 + j]));
+        }
+    }
+
+    AddelkempRowGenerator::AddelkempRowGenerator(const GaloisField & gf, int ncol)
+        : OARowGenerator(gf, 2 * gf.u_q * gf.u_q, static_cast<size_t>(ncol)),
+        m_kay(0), m_b(gf.u_q), m_c(gf.u_q), m_k(gf.u_q)
+    {
+        // addelkempcheck throws if it fails
+        oaconstruct::addelkempcheck(gf.q, gf.p, ncol);
+
+        if (gf.p != 2) /* Constants kay,b,c,k for odd p */
+        {
+            oaaddelkemp::akodd(gf, &m_kay, m_b, m_c, m_k);
+        }
+        else /* Constants kay,b,c,k for even p */
+        {
+            oaaddelkemp::akeven(gf, &m_kay, m_b, m_c, m_k);
+        }
+    }
+
+    void AddelkempRowGenerator::computeRow(size_t row, int * values, std::vector<int> & /*scratch*/) const
+    {
+        int temp;
+        size_t col = 0;
+        size_t qsquared = m_gf.u_q * m_gf.u_q;
+        size_t i = (row % qsquared) / m_gf.u_q;
+        size_t j = row % m_gf.u_q;
+        int square = m_gf.times(i,i);
+
+        if (row < qsquared)
+        { /* First q*q rows */
+            if (col < m_ncol)
+            {
+                values[col++] = static_cast<int>(j);
+            }
+            for (size_t m = 1; m < m_gf.u_q && col < m_ncol; m++)
+            {
+                values[col++] = m_gf.plus(i,m_gf.times(m,j));
+            }
+            for (size_t m = 0; m < m_gf.u_q && col < m_ncol; m++)
+            {
+                temp = m_gf.plus(j,m_gf.times(m,i));
+                values[col++] = m_gf.plus(temp,square); /* Rgt cols */
+            }
+            if (col < m_ncol)
+            {
+                values[col++] = static_cast<int>(i);
+            }
+        }
+        else
+        { /* Second q*q rows */
+            int ksquare = m_gf.times(m_kay,square);
+            if (col < m_ncol)
+            {
+                values[col++] = static_cast<int>(j);
+            }
+            for (size_t m = 1; m < m_gf.u_q && col < m_ncol; m++, col++)
+            {
+                // the same column of the first q*q rows plus b(m)
+                temp = m_gf.plus(i,m_gf.times(m,j));
+                values[col] = m_gf.plus(temp, m_b[m]);
+            }
+            if (col < m_ncol)
+            {
+                values[col++] = m_gf.plus(ksquare,j); /* q+1 */
+            }
+            for (size_t m = 1; m < m_gf.u_q && col < m_ncol; m++)
+            {
+                temp = m_gf.times(i,m_k[m]);
+                temp = m_gf.plus(ksquare,temp);
+                temp = m_gf.plus(j,temp);
+                values[col++] = m_gf.plus(temp,m_c[m]);
+            }
+            if (col < m_ncol)
+            {
+                values[col++] = static_cast<int>(i);
+            }
+        }
+    }
+
+    Addelkemp3RowGenerator::Addelkemp3RowGenerator(const GaloisField & gf, int ncol)
+        : OARowGenerator(gf, 2 * gf.u_q * gf.u_q * gf.u_q, static_cast<size_t>(ncol)),
+        m_kay(0), m_b(gf.u_q), m_c(gf.u_q), m_k(gf.u_q)
+    {
+        // Throws on any error
+        oaaddelkemp::addelkemp3check(gf.q, gf.p, ncol);
+
+        if (gf.p != 2)
+        {
+            oaaddelkemp::akodd(gf, &m_kay, m_b, m_c, m_k); /* Get kay,b,c,k for odd p  */
+        }
+        else
+        {
+            oaaddelkemp::akeven(gf, &m_kay, m_b, m_c, m_k); /* Constants kay,b,c,k for even p */
+        }
+    }
+
+    void Addelkemp3RowGenerator::computeRow(size_t row, int * values, std::vector<int> & /*scratch*/) const
+    {
+        size_t col = 0;
+        size_t qcubed = m_gf.u_q * m_gf.u_q * m_gf.u_q;
+        size_t i1 = (row % qcubed) / (m_gf.u_q * m_gf.u_q);
+        size_t i2 = (row / m_gf.u_q) % m_gf.u_q;
+        size_t i3 = row % m_gf.u_q;
+        int square = m_gf.times(i1,i1);
+
+        if (row < qcubed)
+        { /* First q^3 rows */
+            if (col < m_ncol)
+            {
+                values[col++] = static_cast<int>(i2); /*      y       */
+            }
+            for (size_t m1 = 1; m1 < m_gf.u_q && col < m_ncol; m1++) /* x + my       */
+            {
+                values[col++] = m_gf.plus(i1,m_gf.times(m1,i2));
+            }
+            if (col < m_ncol)
+            {
+                values[col++] = static_cast<int>(i3); /*           z  */
+            }
+            for (size_t m2 = 1; m2 < m_gf.u_q && col < m_ncol; m2++) /* x      + mz  */
+            {
+                values[col++] = m_gf.plus(i1,m_gf.times(m2,i3));
+            }
+            for (size_t m2 = 1; m2 < m_gf.u_q && col < m_ncol; m2++) /*      y + mz  */
+            {
+                values[col++] = m_gf.plus(i2,m_gf.times(m2,i3));
+            }
+            for (size_t m1 = 1; m1 < m_gf.u_q && col < m_ncol; m1++) /* x + my + nz  */
+            {
+                for (size_t m2 = 1; m2 < m_gf.u_q && col < m_ncol; m2++)
+                {
+                    values[col++] =
+                        m_gf.plus(i1,m_gf.plus(m_gf.times(m1,i2),m_gf.times(m2,i3)));
+                }
+            }
+            for (size_t m1 = 0; m1 < m_gf.u_q && col < m_ncol; m1++) /* x^2 + mx + y */
+            {
+                values[col++] = m_gf.plus(square,
+                    m_gf.plus(i2,
+                    m_gf.times(m1,i1)));
+            }
+            for (size_t m1 = 0; m1 < m_gf.u_q && col < m_ncol; m1++) /* x^2 + mx + z */
+            {
+                values[col++] = m_gf.plus(square,
+                    m_gf.plus(i3,
+                    m_gf.times(m1,i1)));
+            }
+            for (size_t m1 = 0; m1 < m_gf.u_q && col < m_ncol; m1++) /* x^2 + mx + y + nz */
+            {
+                for (size_t m2 = 1; m2 < m_gf.u_q && col < m_ncol; m2++)
+                {
+                    values[col++]
+                        = m_gf.plus(square,
+                        m_gf.plus(i2,
+                        m_gf.plus( m_gf.times(m2,i3) ,
+                        m_gf.times(m1,i1)
+                        )
+                        )
+                        );
+                }
+            }
+            if (col < m_ncol)
+            {
+                values[col++] = static_cast<int>(i1); /* x            */
+            }
+        }
+        else
+        { /* Second q^3 rows */
+            int ksquare = m_gf.times(m_kay,square);
+            if (col < m_ncol)
+            {
+                values[col++] = static_cast<int>(i2); /*     y        */
+            }
+            for (size_t m1 = 1; m1 < m_gf.u_q && col < m_ncol; m1++)
+            { /* x + my + b(m)      */
+                values[col] = m_gf.plus(i1,m_gf.times(m1,i2));
+                values[col] = m_gf.plus(values[col],m_b[m1]);
+                col++;
+            }
+            if (col < m_ncol)
+            {
+                values[col++] = static_cast<int>(i3); /*           z  */
+            }
+            for (size_t m2 = 1; m2 < m_gf.u_q && col < m_ncol; m2++)
+            { /* x      + mz + b(m) */
+                values[col] = m_gf.plus(i1,m_gf.times(m2,i3));
+                values[col] = m_gf.plus(values[col],m_b[m2]);
+                col++;
+            }
+            for (size_t m2 = 1; m2 < m_gf.u_q && col < m_ncol; m2++) /*      y + mz  */
+            {
+                values[col++] = m_gf.plus(i2,m_gf.times(m2,i3));
+            }
+            for (size_t m1 = 1; m1 < m_gf.u_q && col < m_ncol; m1++) /* x + my + nz + b(m) */
+            {
+                for (size_t m2 = 1; m2 < m_gf.u_q && col < m_ncol; m2++)
+                {
+                    values[col] =
+                            m_gf.plus(i1,m_gf.plus(m_gf.times(m1,i2),m_gf.times(m2,i3)));
+                    values[col] = m_gf.plus(values[col],m_b[m1]);
+                    col++;
+                }
+            }
+            for (size_t m1 = 0; m1 < m_gf.u_q && col < m_ncol; m1++)
+            { /* kx^2 + k(m)x + y + c(m)*/
+                values[col] = m_gf.plus(ksquare,
+                        m_gf.plus(i2,
+                        m_gf.times(m_k[m1],i1)));
+                values[col] = m_gf.plus(values[col],m_c[m1]);
+                col++;
+            }
+            for (size_t m1 = 0; m1 < m_gf.u_q && col < m_ncol; m1++)
+            { /* kx^2 + k(m)x + z + c(m)*/
+                values[col] = m_gf.plus(ksquare,
+                        m_gf.plus(i3,
+                        m_gf.times(m_k[m1],i1)));
+                values[col] = m_gf.plus(values[col],m_c[m1]);
+                col++;
+            }
+            for (size_t m1 = 0; m1 < m_gf.u_q && col < m_ncol; m1++) /* kx^2 + k(m)x + y + nz +c(m) */
+            {
+                for (size_t m2 = 1; m2 < m_gf.u_q && col < m_ncol; m2++)
+                {
+                    values[col]
+                            = m_gf.plus(ksquare,
+                            m_gf.plus(i2,
+                            m_gf.plus( m_gf.times(m2,i3) ,
+                            m_gf.times(m_k[m1],i1)
+                            )
+                            )
+                            );
+                    values[col] = m_gf.plus( values[col] , m_c[m1] );
+                    col++;
+                }
+            }
+            if (col < m_ncol)
+            {
+                values[col++] = static_cast<int>(i1); /* x            */
+            }
+        }
+    }
+
+    AddelkempNRowGenerator::AddelkempNRowGenerator(const GaloisField & gf, int akn, int ncol)
+        : OARowGenerator(gf, 2 * static_cast<size_t>(primes::ipow(gf.q, akn)), static_cast<size_t>(ncol)),
+        m_akn(akn), m_half(static_cast<size_t>(primes::ipow(gf.q, akn))),
+        m_kay(0), m_b(gf.u_q), m_c(gf.u_q), m_k(gf.u_q)
+    {
+        oaaddelkemp::addelkempncheck(gf.q, gf.p, akn, ncol);
+
+        if (gf.p != 2) /* Constants kay,b,c,k for odd p */
+        {
+            oaaddelkemp::akodd(gf, &m_kay, m_b, m_c, m_k);
+        }
+        else /* Constants kay,b,c,k for even p */
+        {
+            oaaddelkemp::akeven(gf, &m_kay, m_b, m_c, m_k);
+        }
+    }
+
+    size_t AddelkempNRowGenerator::getScratchSize() const
+    {
+        return 4 * static_cast<size_t>(m_akn);
+    }
+
+    void AddelkempNRowGenerator::computeRow(size_t row, int * values, std::vector<int> & scratch) const
+    {
+        int monic, elt;
+        size_t numin;
+        size_t col = 0;
+        size_t aknu = static_cast<size_t>(m_akn);
+        bool secondHalf = row >= m_half;
+
+        // four arrays of akn elements in the scratch storage
+        int * s = scratch.data();
+        int * coef = s + aknu;
+        int * indx = coef + aknu;
+        int * x = indx + aknu;
+
+        /* x holds the base q digits of the row within its half, x[akn-1] least significant */
+        size_t digits = row % m_half;
+        for (int i = m_akn - 1; i >= 0; i--) // has to be an int to decrement
+        {
+            x[static_cast<size_t>(i)] = static_cast<int>(digits % m_gf.u_q);
+            digits /= m_gf.u_q;
+        }
+
+        s[0] = 1;
+        for (size_t i = 1; i < aknu; i++) /* first subset */
+        {
+            s[i] = 0; /* nonempty subsets of x indices */
+        }
+        for (size_t sub = 1; sub < static_cast<size_t>(primes::ipow(2, m_akn)) && col < m_ncol; sub++)
+        {
+            monic = -1;
+            numin = 0;
+            for (size_t i = 0; i < aknu; i++)
+            {
+                if (s[i] != 0)
+                {
+                    if (monic == -1)
+                    {
+                        monic = static_cast<int>(i);
+                    }
+                    else
+                    {
+                        indx[numin++] = static_cast<int>(i);
+                    }
+                }
+            }
+            for (size_t i = 0; i < numin; i++)
+            {
+                coef[i] = 1;
+            }
+            for (size_t poly = 0; poly < static_cast<size_t>(primes::ipow(m_gf.q - 1, static_cast<int>(numin))) && col < m_ncol; poly++)
+            {
+                elt = x[monic];
+                if (secondHalf && numin != 0 && s[0] != 0)
+                {
+                    elt = m_gf.plus(elt,m_b[coef[0]]);
+                }
+                for (size_t i = 0; i < numin; i++)
+                {
+                    elt = m_gf.plus(elt, m_gf.times(coef[i],x[indx[i]]));
+                }
+                values[col++] = elt;
+                for (int i = static_cast<int>(numin) - 1; i >= 0; i--) // has to be an int to decrement
+                {
+                    size_t ui = static_cast<size_t>(i);
+                    coef[ui] = (coef[ui] + 1) % m_gf.q;
+                    if (coef[ui] != 0)
+                    {
+                        break;
+                    }
+                    coef[ui] = 1;
+                }
+            }
+            for (size_t i = 0; i < aknu; i++)
+            {
+                s[i] = (s[i] + 1) % 2;
+                if (s[i] != 0)
+                {
+                    break;
+                }
+            }
+        }
+
+        int square = m_gf.times(x[0], x[0]);
+        if (secondHalf)
+        {
+            square = m_gf.times(m_kay, square);
+        }
+
+        s[1] = 1;
+        for (size_t i = 2; i < aknu; i++) /* first subset */
+        {
+            s[i] = 0; /* nonempty subsets of x indices */
+        }
+        for (size_t sub = 1; sub < static_cast<size_t>(primes::ipow(2, m_akn - 1)) && col < m_ncol; sub++)
+        {
+            monic = -1;
+            numin = 0;
+            for (size_t i = 1; i < aknu; i++)
+            {
+                if (s[i] != 0)
+                {
+                    if (monic == -1)
+                    {
+                        monic = static_cast<int>(i);
+                    }
+                    else
+                    {
+                        indx[numin++] = static_cast<int>(i);
+                    }
+                }
+            }
+            coef[0] = 0;
+            for (size_t i = 1; i < numin + 1; i++)
+            {
+                coef[i] = 1;
+            }
+            int polymax = m_gf.q * primes::ipow(m_gf.q - 1, static_cast<int>(numin));
+            for (size_t poly = 0; poly < static_cast<size_t>(polymax) && col < m_ncol; poly++)
+            {
+                if (secondHalf)
+                {
+                    elt = m_gf.plus(square,m_gf.times(x[0],m_k[coef[0]]));
+                    elt = m_gf.plus(elt,x[monic]);
+                    elt = m_gf.plus(elt,m_c[coef[0]]);
+                }
+                else
+                {
+                    elt = m_gf.plus(square,m_gf.times(x[0],coef[0]));
+                    elt = m_gf.plus(elt,x[monic]);
+                }
+                for (size_t i = 1; i < numin + 1; i++)
+                {
+                    elt = m_gf.plus(elt,m_gf.times(coef[i],x[indx[i - 1]]));
+                }
+                values[col++] = elt;
+                for (int i = static_cast<int>(numin); i >= 0; i--) // has to be an int to decrement
+                {
+                    size_t ui = static_cast<size_t>(i);
+                    coef[ui] = (coef[ui] + 1) % m_gf.q;
+                    if (coef[ui] != 0)
+                    {
+                        break;
+                    }
+                    coef[ui] = i > 0 ? 1 : 0;
+                }
+            }
+            for (size_t i = 1; i < aknu; i++)
+            {
+                s[i] = (s[i] + 1) % 2;
+                if (s[i] != 0)
+                {
+                    break;
+                }
+            }
+        }
+    }
+} // end namespace
@@ -0,0 +1,252 @@
+/**
+ * @file OARowGenerator.h
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License:  This file may be freely used and shared according to the original license.
+ *
+ * Reference:
+ * <ul><li><a href="http://lib.stat.cmu.edu/designs/">Statlib Designs</a></li>
+ * <li><a href="http://lib.stat.cmu.edu/designs/oa.c">Owen's Orthogonal Array Algorithms</a></li></ul>
+ *
+ * Original Header:
+ * <blockquote>
+ * These programs construct and manipulate orthogonal arrays.  They were prepared by
+ *
+ * - Art Owen
+ * - Department of Statistics
+ * - Sequoia Hall
+ * - Stanford CA 94305
+ *
+ * They may be freely used and shared.  This code comes
+ * with no warranty of any kind.  Use it at your own
+ * risk.
+ *
+ * I thank the Semiconductor Research Corporation and
+ * the National Science Foundation for supporting this
+ * work.
+ * </blockquote>
+ */
+
+#ifndef OAROWGENERATOR_H
+#define OAROWGENERATOR_H
+
+#include "OACommonDefines.h"
+#include "GaloisField.h"
+#include "construct.h"
+#include "ak.h"
+#include "parallelFor.h"
+
+namespace oacpp {
+    /**
+     * Produce the rows of an algebraic orthogonal array on demand
+     *
+     * Each row of the Bose, Bush, and Addelman-Kempthorne constructions is a
+     * function of the row index and the Galois field only, so a design can be
+     * streamed one row or one block of rows at a time without holding the
+     * whole array.  Generators are immutable after construction and may be
+     * shared between threads.
+     *
+     * @note the Galois field must outlive the generator
+     */
+    class OARowGenerator
+    {
+    public:
+        /** Destructor */
+        virtual ~OARowGenerator() {}
+
+        /**
+         * Get the number of rows in the orthogonal array
+         * @return the number of rows
+         */
+        size_t getNumberRows() const {return m_nrow;};
+
+        /**
+         * Get the number of columns in the orthogonal array
+         * @return the number of columns
+         */
+        size_t getNumberCols() const {return m_ncol;};
+
+        /**
+         * Compute one row of the orthogonal array
+         * @param row the row index
+         * @param values the row values, resized to the number of columns
+         * @throws std::out_of_range if the row is not in the array
+         */
+        void getRow(size_t row, std::vector<int> & values) const;
+
+        /**
+         * Compute a block of consecutive rows of the orthogonal array
+         * @param firstRow the index of the first row in the block
+         * @param block a matrix with at least as many columns as the array.
+         * The number of rows in the matrix sets the size of the block
+         * @throws std::out_of_range if the block extends past the last row
+         */
+        void getRows(size_t firstRow, bclib::matrix<int> & block) const;
+
+        /**
+         * Compute every row of the orthogonal array
+         *
+         * Large arrays are split into contiguous row ranges that are computed
+         * on up to <code>bclib::getMaxThreads()</code> threads, each with at
+         * least <code>OA_MIN_ROWS_PER_THREAD</code> rows.
+         *
+         * @param A a matrix with at least as many rows and columns as the array
+         */
+        void fill(bclib::matrix<int> & A) const;
+
+        /**
+         * Compute every row of the orthogonal array on a fixed number of threads
+         * @param A a matrix with at least as many rows and columns as the array
+         * @param nthreads the number of threads.  Each thread writes its own
+         * disjoint range of rows of <code>A</code>
+         */
+        void fill(bclib::matrix<int> & A, unsigned int nthreads) const;
+
+    protected:
+        /**
+         * Constructor
+         * @param gf a Galois field
+         * @param nrow the number of rows
+         * @param ncol the number of columns
+         */
+        OARowGenerator(const GaloisField & gf, size_t nrow, size_t ncol);
+
+        /**
+         * Compute one row without range checks
+         * @param row the row index
+         * @param values storage for at least <code>m_ncol</code> values
+         * @param scratch working storage of <code>getScratchSize()</code>
+         * elements, allocated once by the caller and reused for every row
+         */
+        virtual void computeRow(size_t row, int * values, std::vector<int> & scratch) const = 0;
+
+        /**
+         * Get the size of the working storage that <code>computeRow</code> needs
+         * @return the number of elements
+         */
+        virtual size_t getScratchSize() const {return 0;};
+
+        /**
+         * Compute a range of rows into the orthogonal array
+         * @param A the orthogonal array
+         * @param firstRow the first row in the range
+         * @param lastRow one past the last row in the range
+         */
+        void fillRange(bclib::matrix<int> & A, size_t firstRow, size_t lastRow) const;
+
+        const GaloisField & m_gf; /**< the Galois field */
+        size_t m_nrow; /**< the number of rows */
+        size_t m_ncol; /**< the number of columns */
+    };
+
+    /**
+     * Row generator for the Bose OA( q^2, q+1, q, 2 )
+     */
+    class BoseRowGenerator : public OARowGenerator
+    {
+    public:
+        /**
+         * Constructor
+         * @param gf a Galois field
+         * @param ncol the number of columns
+         * @throws std::runtime_error if the parameters are inconsistent
+         */
+        BoseRowGenerator(const GaloisField & gf, int ncol);
+    protected:
+        void computeRow(size_t row, int * values, std::vector<int> & scratch) const;
+    };
+
+    /**
+     * Row generator for the Bush OA( q^str, q+1, q, str )
+     */
+    class BushRowGenerator : public OARowGenerator
+    {
+    public:
+        /**
+         * Constructor
+         * @param gf a Galois field
+         * @param str the array strength
+         * @param ncol the number of columns
+         * @throws std::runtime_error if the parameters are inconsistent
+         */
+        BushRowGenerator(const GaloisField & gf, int str, int ncol);
+    protected:
+        void computeRow(size_t row, int * values, std::vector<int> & scratch) const;
+        size_t getScratchSize() const;
+    private:
+        int m_str; /**< the array strength */
+    };
+
+    /**
+     * Row generator for the Addelman-Kempthorne OA( 2q^2, 2q+1, q, 2 )
+     */
+    class AddelkempRowGenerator : public OARowGenerator
+    {
+    public:
+        /**
+         * Constructor
+         * @param gf a Galois field
+         * @param ncol the number of columns
+         * @throws std::runtime_error if the parameters are inconsistent
+         */
+        AddelkempRowGenerator(const GaloisField & gf, int ncol);
+    protected:
+        void computeRow(size_t row, int * values, std::vector<int> & scratch) const;
+    private:
+        int m_kay; /**< Addelman-Kempthorne constant */
+        std::vector<int> m_b; /**< Addelman-Kempthorne constants */
+        std::vector<int> m_c; /**< Addelman-Kempthorne constants */
+        std::vector<int> m_k; /**< Addelman-Kempthorne constants */
+    };
+
+    /**
+     * Row generator for the Addelman-Kempthorne OA( 2q^3, 2q^2+2q+1, q, 2 )
+     */
+    class Addelkemp3RowGenerator : public OARowGenerator
+    {
+    public:
+        /**
+         * Constructor
+         * @param gf a Galois field
+         * @param ncol the number of columns
+         * @throws std::runtime_error if the parameters are inconsistent
+         */
+        Addelkemp3RowGenerator(const GaloisField & gf, int ncol);
+    protected:
+        void computeRow(size_t row, int * values, std::vector<int> & scratch) const;
+    private:
+        int m_kay; /**< Addelman-Kempthorne constant */
+        std::vector<int> m_b; /**< Addelman-Kempthorne constants */
+        std::vector<int> m_c; /**< Addelman-Kempthorne constants */
+        std::vector<int> m_k; /**< Addelman-Kempthorne constants */
+    };
+
+    /**
+     * Row generator for the Addelman-Kempthorne OA( 2q^n, 2(q^n-1)/(q-1)-1, q, 2 )
+     */
+    class AddelkempNRowGenerator : public OARowGenerator
+    {
+    public:
+        /**
+         * Constructor
+         * @param gf a Galois field
+         * @param akn the exponent n
+         * @param ncol the number of columns
+         * @throws std::runtime_error if the parameters are inconsistent
+         */
+        AddelkempNRowGenerator(const GaloisField & gf, int akn, int ncol);
+    protected:
+        void computeRow(size_t row, int * values, std::vector<int> & scratch) const;
+        size_t getScratchSize() const;
+    private:
+        int m_akn; /**< the exponent n */
+        size_t m_half; /**< the number of rows in each half of the array, q^n */
+        int m_kay; /**< Addelman-Kempthorne constant */
+        std::vector<int> m_b; /**< Addelman-Kempthorne constants */
+        std::vector<int> m_c; /**< Addelman-Kempthorne constants */
+        std::vector<int> m_k; /**< Addelman-Kempthorne constants */
+    };
+} // end namespace
+
+#endif
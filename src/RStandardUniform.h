@@ -40,6 +40,16 @@ namespace lhs_r
         {
             return Rcpp::as<double>(Rcpp::runif(1));
         };
+
+        /**
+         * the uniform callback of the C interface in lhs_c.h
+         * @param state a pointer to an <code>RStandardUniform</code>
+         * @return the random deviate
+         */
+        static double uniform(void * state)
+        {
+            return static_cast<RStandardUniform *>(state)->getNextRandom();
+        };
     };
 }
 
@@ -0,0 +1,188 @@
+/**
+ * @file RunStatistics.h
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * @license <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RUNSTATISTICS_H
+#define	RUNSTATISTICS_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <utility>
+#include <chrono>
+#include "CRandom.h"
+
+namespace bclib {
+
+/**
+ * Statistics of one run of an algorithm
+ *
+ * Every engine that accepts a <code>RunStatistics</code> pointer adds to the
+ * counts, so one object can collect a run made of several calls.  The engines
+ * do nothing extra when the pointer is <code>NULL</code>.  The meaning of a
+ * criterion evaluation, a candidate and an accepted move depends on the engine
+ * and is given in its documentation.
+ */
+struct RunStatistics
+{
+    /** the type of the counts */
+    typedef unsigned long long count_type;
+
+    /** the number of times the optimality criterion was evaluated */
+    count_type criterionEvaluations;
+    /** the number of candidate points, swaps, or designs that were scored */
+    count_type candidatesScored;
+    /** the number of candidates that were accepted into the design */
+    count_type acceptedMoves;
+    /** the number of uniform random numbers drawn */
+    count_type randomDraws;
+    /** the bytes of working storage the engine allocated */
+    count_type bytesAllocated;
+    /** the value of the optimality criterion after each step of the engine */
+    std::vector<double> criterionTrajectory;
+    /** the wall time in seconds of each phase, in the order the phases started */
+    std::vector<std::pair<std::string, double> > phaseSeconds;
+
+    /** Constructor with every count zero */
+    RunStatistics()
+        : criterionEvaluations(0), candidatesScored(0), acceptedMoves(0),
+        randomDraws(0), bytesAllocated(0)
+    {}
+
+    /**
+     * Add the wall time of a phase, accumulating phases of the same name
+     * @param phase the name of the phase
+     * @param seconds the elapsed wall time
+     */
+    void addPhaseSeconds(const std::string & phase, double seconds)
+    {
+        for (size_t i = 0; i < phaseSeconds.size(); i++)
+        {
+            if (phaseSeconds[i].first == phase)
+            {
+                phaseSeconds[i].second += seconds;
+                return;
+            }
+        }
+        phaseSeconds.push_back(std::pair<std::string, double>(phase, seconds));
+    }
+
+    /**
+     * Add the storage of a container of <code>count</code> elements of type T
+     * @param count the number of elements
+     * @tparam T the type of the elements
+     */
+    template <class T>
+    void addAllocation(size_t count)
+    {
+        bytesAllocated += static_cast<count_type>(count) * sizeof(T);
+    }
+};
+
+/**
+ * Time a phase of an algorithm into a <code>RunStatistics</code>
+ *
+ * The phase ends when <code>stop</code> is called or the timer goes out of
+ * scope, so a phase that throws is still recorded.
+ */
+class PhaseTimer
+{
+public:
+    /**
+     * Constructor that starts the phase
+     * @param stats the statistics, or <code>NULL</code> to time nothing
+     * @param phase the name of the phase
+     */
+    PhaseTimer(RunStatistics * stats, const char * phase)
+        : m_stats(stats), m_phase(phase)
+    {
+        if (m_stats != NULL)
+        {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    /** Destructor that ends the phase if it has not been stopped */
+    ~PhaseTimer()
+    {
+        stop();
+    }
+
+    /** End the phase and record its wall time */
+    void stop()
+    {
+        if (m_stats != NULL)
+        {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+            m_stats->addPhaseSeconds(m_phase, elapsed.count());
+            m_stats = NULL;
+        }
+    }
+
+private:
+    RunStatistics * m_stats; /**< the statistics, NULL once stopped */
+    const char * m_phase; /**< the name of the phase */
+    std::chrono::steady_clock::time_point m_start; /**< the start of the phase */
+
+    PhaseTimer(const PhaseTimer &);
+    PhaseTimer & operator=(const PhaseTimer &);
+};
+
+/**
+ * A random number generator that counts the numbers drawn from another
+ * generator without changing the stream
+ */
+class CountingRandom : public CRandom<double>
+{
+public:
+    /**
+     * Constructor
+     * @param oRandom the generator that supplies the numbers
+     */
+    explicit CountingRandom(CRandom<double> & oRandom)
+        : m_random(oRandom), m_draws(0)
+    {}
+
+    /**
+     * Draw the next number from the underlying generator
+     * @return the next random number
+     */
+    double getNextRandom()
+    {
+        m_draws++;
+        return m_random.getNextRandom();
+    }
+
+    /**
+     * The count of numbers drawn
+     * @return the number of calls to <code>getNextRandom</code>
+     */
+    RunStatistics::count_type draws() const
+    {
+        return m_draws;
+    }
+
+private:
+    CRandom<double> & m_random; /**< the underlying generator */
+    RunStatistics::count_type m_draws; /**< the numbers drawn */
+};
+
+} // end namespace
+
+#endif	/* RUNSTATISTICS_H */
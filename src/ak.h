@@ -63,7 +63,7 @@ namespace oacpp {
          * @param k original Addelkemp variable
          * @return an indicator of success
          */
-		int akeven(GaloisField & gf, int* kay, std::vector<int> & b, std::vector<int> & c, std::vector<int> & k);
+		int akeven(const GaloisField & gf, int* kay, std::vector<int> & b, std::vector<int> & c, std::vector<int> & k);
         
         /**
          * Addelkemp algorithm for odd <code>p</code>
@@ -75,7 +75,7 @@ namespace oacpp {
          * @param k original Addelkemp variable
          * @return an indicator of success
          */
-		int akodd(GaloisField & gf, int* kay, std::vector<int> & b, std::vector<int> & c, std::vector<int> & k);
+		int akodd(const GaloisField & gf, int* kay, std::vector<int> & b, std::vector<int> & c, std::vector<int> & k);
         
         /**
          * Check that the parameters are consistent for the addelkempn algorithm
@@ -98,7 +98,7 @@ namespace oacpp {
          * @param ncol the number of columns
          * @return an indicator of success
          */
-		int addelkempn(GaloisField & gf, int akn, bclib::matrix<int> & A, int ncol);
+		int addelkempn(const GaloisField & gf, int akn, bclib::matrix<int> & A, int ncol);
         
         /**
          * The addelkemp algorithm for n=3
@@ -108,7 +108,7 @@ namespace oacpp {
          * @param ncol the number of columns
          * @return an indicator of success
          */
-		int addelkemp3(GaloisField & gf, bclib::matrix<int> & A, int ncol );
+		int addelkemp3(const GaloisField & gf, bclib::matrix<int> & A, int ncol );
 	}
 }
 
@@ -29,6 +29,7 @@
  */
 
 #include "ak.h"
+#include "OARowGenerator.h"
 
 namespace oacpp
 {
@@ -57,191 +58,11 @@ namespace oacpp
         }
 
         /* Implement Addelman and Kempthorne's 1961 A.M.S. method with n=3 */
-        int addelkemp3(GaloisField & gf, bclib::matrix<int> & A, int ncol)
+        int addelkemp3(const GaloisField & gf, bclib::matrix<int> & A, int ncol)
         {
-            int kay;
-            //std::vector<int> b, c, k; /* A&K notation */
-            int square, ksquare;
-			size_t row, col;
-            size_t u_ncol = static_cast<size_t>(ncol);
-
-			// Throws on any error
-			addelkemp3check(gf.q, gf.p, ncol);
-
-            std::vector<int> b(gf.u_q);
-            std::vector<int> c(gf.u_q);
-            std::vector<int> k(gf.u_q);
-
-            for (size_t i1 = 0; i1 < gf.u_q; i1++)
-            { /* First q^3 rows */
-                square = gf.times(i1,i1);
-                for (size_t i2 = 0; i2 < gf.u_q; i2++)
-                {
-                    for (size_t i3 = 0; i3 < gf.u_q; i3++)
-                    {
-                        row = i3 + gf.u_q * i2 + gf.u_q * gf.u_q * i1;
-                        col = 0;
-                        if (col < u_ncol)
-                        {
-                            A(row, col++) = static_cast<int>(i2); /*      y       */
-                        }
-                        for (size_t m1 = 1; m1 < gf.u_q && col < u_ncol; m1++) /* x + my       */
-                        {
-                            A(row,col++) = gf.plus(i1,gf.times(m1,i2));
-                        }
-                        if (col < u_ncol)
-                        {
-                            A(row, col++) = static_cast<int>(i3); /*           z  */
-                        }
-                        for (size_t m2 = 1; m2 < gf.u_q && col < u_ncol; m2++) /* x      + mz  */
-                        {
-                            A(row,col++) = gf.plus(i1,gf.times(m2,i3));
-                        }
-                        for (size_t m2 = 1; m2 < gf.u_q && col < u_ncol; m2++) /*      y + mz  */
-                        {
-                            A(row,col++) = gf.plus(i2,gf.times(m2,i3));
-                        }
-                        for (size_t m1 = 1; m1 < gf.u_q && col < u_ncol; m1++) /* x + my + nz  */
-                        {
-                            for (size_t m2 = 1; m2 < gf.u_q && col < u_ncol; m2++)
-                            {
-                                A(row,col++) =
-                                    gf.plus(i1,gf.plus(gf.times(m1,i2),gf.times(m2,i3)));
-                            }
-                        }
-                        for (size_t m1 = 0; m1 < gf.u_q && col < u_ncol; m1++) /* x^2 + mx + y */
-                        {
-                            A(row,col++) = gf.plus(square,
-                                gf.plus(i2,
-                                gf.times(m1,i1)));
-                        }
-
-                        for (size_t m1 = 0; m1 < gf.u_q && col < u_ncol; m1++) /* x^2 + mx + z */
-                        {
-                            A(row,col++) = gf.plus(square,
-                                gf.plus(i3,
-                                gf.times(m1,i1)));
-                        }
-
-                        for (size_t m1 = 0; m1 < gf.u_q && col < u_ncol; m1++) /* x^2 + mx + y + nz */
-                        {
-                            for (size_t m2 = 1; m2 < gf.u_q && col < u_ncol; m2++)
-                            {
-                                A(row,col++)
-                                    = gf.plus(square,
-                                    gf.plus(i2,
-                                    gf.plus( gf.times(m2,i3) ,
-                                    gf.times(m1,i1)
-                                    )
-                                    )
-                                    );
-                            }
-                        }
-                        if (col < u_ncol)
-                        {
-                            A(row, col++) = static_cast<int>(i1); /* x            */
-                        }
-                    }
-                }
-            }
-
-            if (gf.p != 2)
-            {
-                akodd(gf, &kay, b, c, k); /* Get kay,b,c,k for odd p  */
-            }
-            else
-            {
-                akeven(gf, &kay, b, c, k); /* Constants kay,b,c,k for even p */
-            }
-
-            for (size_t i1 = 0; i1 < gf.u_q; i1++)
-            { /* Second q^3 rows */
-                square = gf.times(i1,i1);
-                ksquare = gf.times(kay,square);
-                for (size_t i2 = 0; i2 < gf.u_q; i2++)
-                {
-                    for (size_t i3 = 0; i3 < gf.u_q; i3++)
-                    {
-                        row = i3 + gf.u_q * i2 + gf.u_q * gf.u_q * i1 + gf.u_q * gf.u_q * gf.u_q;
-                        col = 0;
-                        if (col < u_ncol)
-                        {
-                            A(row, col++) = static_cast<int>(i2); /*     y        */
-                        }
-                        for (size_t m1 = 1; m1 < gf.u_q && col < u_ncol; m1++)
-                        { /* x + my + b(m)      */
-                            A(row,col) = gf.plus(i1,gf.times(m1,i2));
-                            A(row,col) = gf.plus(A(row,col),b[m1]);
-                            col++;
-                        }
-                        if (col < u_ncol)
-                        {
-                            A(row,col++) = static_cast<int>(i3); /*           z  */
-                        }
-
-                        for (size_t m2 = 1; m2 < gf.u_q && col < u_ncol; m2++)
-                        { /* x      + mz + b(m) */
-                            A(row,col) = gf.plus(i1,gf.times(m2,i3));
-                            A(row,col) = gf.plus(A(row,col),b[m2]);
-                            col++;
-                        }
-                        for (size_t m2 = 1; m2 < gf.u_q && col < u_ncol; m2++) /*      y + mz  */
-                        {
-                            A(row,col++) = gf.plus(i2,gf.times(m2,i3));
-                        }
-
-                        for (size_t m1 = 1; m1 < gf.u_q && col < u_ncol; m1++) /* x + my + nz + b(m) */
-                        {
-                            for (size_t m2 = 1; m2 < gf.u_q && col < u_ncol; m2++)
-                            {
-                                A(row,col) =
-                                        gf.plus(i1,gf.plus(gf.times(m1,i2),gf.times(m2,i3)));
-                                A(row,col) = gf.plus(A(row,col),b[m1]);
-                                col++;
-                            }
-                        }
-
-                        for (size_t m1 = 0; m1 < gf.u_q && col < u_ncol; m1++)
-                        { /* kx^2 + k(m)x + y + c(m)*/
-                            A(row,col) = gf.plus(ksquare,
-                                    gf.plus(i2,
-                                    gf.times(k[m1],i1)));
-                            A(row,col) = gf.plus(A(row,col),c[m1]);
-                            col++;
-                        }
-
-                        for (size_t m1 = 0; m1 < gf.u_q && col < u_ncol; m1++)
-                        { /* kx^2 + k(m)x + z + c(m)*/
-                            A(row,col) = gf.plus(ksquare,
-                                    gf.plus(i3,
-                                    gf.times(k[m1],i1)));
-                            A(row,col) = gf.plus(A(row,col),c[m1]);
-                            col++;
-                        }
-
-                        for (size_t m1 = 0; m1 < gf.u_q && col < u_ncol; m1++) /* kx^2 + k(m)x + y + nz +c(m) */
-                        {
-                            for (size_t m2 = 1; m2 < gf.u_q && col < u_ncol; m2++)
-                            {
-                                A(row,col)
-                                        = gf.plus(ksquare,
-                                        gf.plus(i2,
-                                        gf.plus( gf.times(m2,i3) ,
-                                        gf.times(k[m1],i1)
-                                        )
-                                        )
-                                        );
-                                A(row,col) = gf.plus( A(row,col) , c[m1] );
-                                col++;
-                            }
-                        }
-                        if (col < u_ncol)
-                        {
-                            A(row, col++) = static_cast<int>(i1); /* x            */
-                        }
-                    }
-                }
-            }
+            // the generator checks the inputs and throws if they fail
+            Addelkemp3RowGenerator generator(gf, ncol);
+            generator.fill(A);
             return 1;
         }
     } // end namespace
@@ -36,7 +36,7 @@ namespace oacpp
     {
         /*  Find constants for Addelman Kempthorne designs
           when q is even. */
-        int akeven(GaloisField & gf, int* kay, std::vector<int> & b, std::vector<int> & c, std::vector<int> & k)
+        int akeven(const GaloisField & gf, int* kay, std::vector<int> & b, std::vector<int> & c, std::vector<int> & k)
         {
             if (gf.q > 4)
             {
@@ -68,7 +68,7 @@ namespace oacpp
             return 0;
         }
 
-        int akodd(GaloisField & gf, int* kay, std::vector<int> & b, std::vector<int> & c, std::vector<int> & k)
+        int akodd(const GaloisField & gf, int* kay, std::vector<int> & b, std::vector<int> & c, std::vector<int> & k)
         {
             int num, den, four;
 
@@ -0,0 +1,343 @@
+/**
+ * @file alignedMatrix.h
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * @license <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ALIGNEDMATRIX_H
+#define	ALIGNEDMATRIX_H
+
+#include <cstdlib>
+#include <cstdint>
+#include <new>
+#include <limits>
+#include "matrix.h"
+
+/**
+ * The alignment in bytes of the storage of an <code>alignedMatrix</code>.
+ * One cache line, which is also the width of the widest SIMD registers
+ */
+#define BCLIB_ALIGNMENT 64
+
+/**
+ * The rows of an <code>alignedMatrix</code> are padded to a multiple of this
+ * many bytes, the width of the SIMD registers every x86-64 and ARMv8 processor
+ * has.  Padding each row to a full cache line would multiply the work of the
+ * distance kernels for the few columns typical of Latin hypercubes.
+ */
+#define BCLIB_SIMD_BYTES 16
+
+/**
+ * Tell the compiler that a pointer is aligned to <code>BCLIB_SIMD_BYTES</code>
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define BCLIB_ASSUME_ALIGNED(p) __builtin_assume_aligned((p), BCLIB_SIMD_BYTES)
+#else
+#define BCLIB_ASSUME_ALIGNED(p) (p)
+#endif
+
+namespace bclib {
+
+/**
+ * An allocator that aligns every allocation to <code>ALIGN</code> bytes
+ *
+ * C++11 has no aligned allocation, so the block is over-allocated and the
+ * address of the underlying allocation is stored just before the aligned
+ * address.
+ *
+ * @tparam T the type of object allocated
+ * @tparam ALIGN the alignment in bytes, a power of 2 at least the size of a pointer
+ */
+template <class T, size_t ALIGN = BCLIB_ALIGNMENT>
+class alignedAllocator
+{
+public:
+    typedef T value_type; /**< the type of object allocated */
+
+    /** the allocator for another type with the same alignment */
+    template <class U>
+    struct rebind
+    {
+        typedef alignedAllocator<U, ALIGN> other; /**< the rebound allocator */
+    };
+
+    /// Default Constructor
+    alignedAllocator() {}
+
+    /**
+     * Copy Constructor from an allocator of another type
+     * @param other the allocator to copy
+     */
+    template <class U>
+    alignedAllocator(const alignedAllocator<U, ALIGN> & other) {}
+
+    /**
+     * Allocate aligned memory
+     * @throws std::bad_alloc if the memory cannot be allocated
+     * @param n the number of objects
+     * @return a pointer to the aligned memory
+     */
+    T* allocate(size_t n)
+    {
+        if (n > (std::numeric_limits<size_t>::max() - ALIGN - sizeof(void*)) / sizeof(T))
+        {
+            throw std::bad_alloc(); // LCOV_EXCL_LINE
+        }
+        void* raw = std::malloc(n * sizeof(T) + ALIGN + sizeof(void*));
+        if (raw == NULL)
+        {
+            throw std::bad_alloc(); // LCOV_EXCL_LINE
+        }
+        uintptr_t address = reinterpret_cast<uintptr_t>(raw) + sizeof(void*);
+        address = (address + ALIGN - 1) & ~static_cast<uintptr_t>(ALIGN - 1);
+        void** aligned = reinterpret_cast<void**>(address);
+        aligned[-1] = raw;
+        return reinterpret_cast<T*>(aligned);
+    }
+
+    /**
+     * Free memory from <code>allocate</code>
+     * @param p the pointer returned by <code>allocate</code>
+     * @param n the number of objects
+     */
+    void deallocate(T* p, size_t n)
+    {
+        if (p != NULL)
+        {
+            std::free(reinterpret_cast<void**>(p)[-1]);
+        }
+    }
+};
+
+/// all aligned allocators with the same alignment are interchangeable
+template <class T, class U, size_t ALIGN>
+bool operator==(const alignedAllocator<T, ALIGN> &, const alignedAllocator<U, ALIGN> &) {return true;}
+
+/// all aligned allocators with the same alignment are interchangeable
+template <class T, class U, size_t ALIGN>
+bool operator!=(const alignedAllocator<T, ALIGN> &, const alignedAllocator<U, ALIGN> &) {return false;}
+
+/**
+ * A row-major matrix with cache line aligned storage and SIMD aligned rows
+ *
+ * The storage starts on a <code>BCLIB_ALIGNMENT</code> byte boundary and each
+ * row is padded with zeros up to a multiple of <code>BCLIB_SIMD_BYTES</code>,
+ * so a loop over the <code>leadingDimension()</code> elements of a row in
+ * blocks of <code>elementsPerBlock</code> needs no remainder loop and every
+ * block can be loaded with aligned SIMD loads.  Rows whose padded length is a
+ * multiple of the cache line also start on a cache line.  The zero padding
+ * leaves sums of squared differences between rows unchanged.
+ * The matrix is a working copy for the distance kernels rather than a
+ * replacement for <code>matrix</code>.
+ *
+ * @tparam T the type of number stored in the matrix
+ */
+template <class T>
+class alignedMatrix
+{
+public:
+    typedef size_t size_type; /**< define the size_type as std::vector */
+
+    /** the number of elements of type T in one SIMD register */
+    static const size_type elementsPerBlock = (BCLIB_SIMD_BYTES % sizeof(T) == 0) ? BCLIB_SIMD_BYTES / sizeof(T) : 1;
+
+    /// Default Constructor with zero rows and zero columns
+    alignedMatrix() : m_rows(0), m_cols(0), m_ld(0) {};
+
+    /**
+     * Constructor
+     * @param rows the number of rows
+     * @param cols the number of columns
+     */
+    alignedMatrix(size_type rows, size_type cols)
+        : m_rows(0), m_cols(0), m_ld(0)
+    {
+        resize(rows, cols);
+    }
+
+    /**
+     * Constructor from a matrix
+     * @param mat the matrix to copy
+     */
+    explicit alignedMatrix(const matrix<T> & mat)
+        : m_rows(0), m_cols(0), m_ld(0)
+    {
+        assign(mat);
+    }
+
+    /**
+     * Change the size of the matrix.  The elements are set to zero
+     * @param rows the number of rows
+     * @param cols the number of columns
+     */
+    void resize(size_type rows, size_type cols)
+    {
+        m_rows = rows;
+        m_cols = cols;
+        m_ld = paddedLength(cols);
+        m_elements.assign(m_rows * m_ld, static_cast<T>(0));
+    }
+
+    /**
+     * Copy the elements of a matrix, reusing the storage when the size allows it
+     * @param mat the matrix to copy
+     */
+    void assign(const matrix<T> & mat)
+    {
+        if (mat.rowsize() != m_rows || mat.colsize() != m_cols)
+        {
+            resize(mat.rowsize(), mat.colsize());
+        }
+        if (mat.isTransposed())
+        {
+            copyFrom(mat.columnMajorView());
+        }
+        else
+        {
+            copyFrom(mat.rowMajorView());
+        }
+    }
+
+    /**
+     * Copy the transpose of a matrix, so that each column of the matrix is a
+     * contiguous, aligned row.  The storage is reused when the size allows it
+     * @param mat the matrix to copy
+     * @tparam U the type of object in the matrix, converted to T
+     */
+    template <class U>
+    void assignTranspose(const matrix<U> & mat)
+    {
+        if (mat.colsize() != m_rows || mat.rowsize() != m_cols)
+        {
+            resize(mat.colsize(), mat.rowsize());
+        }
+        if (mat.isTransposed())
+        {
+            copyFrom(mat.columnMajorView().transposedView());
+        }
+        else
+        {
+            copyFrom(mat.rowMajorView().transposedView());
+        }
+    }
+
+    /// The number of rows
+    size_type rowsize() const {return m_rows;};
+
+    /// The number of columns
+    size_type colsize() const {return m_cols;};
+
+    /// The distance between the starts of consecutive rows, a multiple of <code>elementsPerBlock</code>
+    size_type leadingDimension() const {return m_ld;};
+
+    /**
+     * A pointer to the first element of a row, aligned to <code>BCLIB_SIMD_BYTES</code>
+     * @note does not check for index in range
+     * @param row the row index (zero based)
+     * @return the aligned row
+     */
+    const T* row(size_type row) const
+    {
+        return static_cast<const T*>(BCLIB_ASSUME_ALIGNED(m_elements.data() + row * m_ld));
+    }
+
+    /**
+     * A pointer to the first element of a row, aligned to <code>BCLIB_SIMD_BYTES</code>
+     * @note does not check for index in range
+     * @param row the row index (zero based)
+     * @return the aligned row
+     */
+    T* row(size_type row)
+    {
+        return static_cast<T*>(BCLIB_ASSUME_ALIGNED(m_elements.data() + row * m_ld));
+    }
+
+    /**
+     * element access
+     * @note does not check for index in range
+     * @param row row index (zero based)
+     * @param col column index (zero based)
+     * @return the requested element
+     */
+    const T & operator()(size_type row, size_type col) const
+    {
+        return m_elements[row * m_ld + col];
+    }
+
+    /**
+     * element access
+     * @note does not check for index in range
+     * @param row row index (zero based)
+     * @param col column index (zero based)
+     * @return a reference to the requested element
+     */
+    T & operator()(size_type row, size_type col)
+    {
+        return m_elements[row * m_ld + col];
+    }
+
+    /**
+     * A read-only view of the matrix without the padding
+     * @return the view
+     */
+    matrixView<const T, true> view() const
+    {
+        return matrixView<const T, true>(m_elements.data(), m_rows, m_cols, m_ld);
+    }
+
+    /**
+     * The number of elements in a padded row
+     * @param cols the number of columns
+     * @return <code>cols</code> rounded up to a multiple of <code>elementsPerBlock</code>
+     */
+    static size_type paddedLength(size_type cols)
+    {
+        return (cols + elementsPerBlock - 1) / elementsPerBlock * elementsPerBlock;
+    }
+
+private:
+    size_type m_rows; /**< the number of rows */
+    size_type m_cols; /**< the number of columns */
+    size_type m_ld; /**< the padded row length */
+    std::vector<T, alignedAllocator<T> > m_elements; /**< the padded rows */
+
+    /**
+     * Copy the elements of a view, leaving the padding at zero
+     * @param mat the view to copy, the same size as this matrix
+     * @tparam U the type of object in the view, converted to T
+     * @tparam ROWMAJOR the layout of the view
+     */
+    template <class U, bool ROWMAJOR>
+    void copyFrom(const matrixView<const U, ROWMAJOR> & mat)
+    {
+        for (size_type i = 0; i < m_rows; i++)
+        {
+            T* dest = m_elements.data() + i * m_ld;
+            for (size_type j = 0; j < m_cols; j++)
+            {
+                dest[j] = static_cast<T>(mat(i, j));
+            }
+        }
+    }
+};
+
+template <class T>
+const typename alignedMatrix<T>::size_type alignedMatrix<T>::elementsPerBlock;
+
+} // end namespace
+
+#endif	/* ALIGNEDMATRIX_H */
@@ -0,0 +1,384 @@
+/**
+ * @file blockedDistance.h
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLOCKEDDISTANCE_H
+#define	BLOCKEDDISTANCE_H
+
+#include "LHSCommonDefines.h"
+#include "alignedMatrix.h"
+#include "simdDistance.h"
+#include "parallelFor.h"
+#include <limits>
+#include <type_traits>
+
+namespace lhslib
+{
+    /**
+     * The type of the squared distances between points with coordinates of type T
+     * @tparam T the type of the coordinates
+     */
+    template <class T>
+    struct squaredDistanceType
+    {
+        typedef T type; /**< the type of the squared distances */
+    };
+
+    /**
+     * 16 bit coordinates are widened, and their squared distances summed, in unsigned 32 bits
+     */
+    template <>
+    struct squaredDistanceType<int16_t>
+    {
+        typedef uint32_t type; /**< the type of the squared distances */
+    };
+
+    /**
+     * The squared distances of 32 bit coordinates are summed in unsigned 32 bits
+     */
+    template <>
+    struct squaredDistanceType<int32_t>
+    {
+        typedef uint32_t type; /**< the type of the squared distances */
+    };
+
+    /**
+     * Sum of the inverse distances between points, for use with <code>reduceAllPairs</code>.
+     * Zero distances are skipped
+     */
+    struct InverseDistanceSum
+    {
+        double total; /**< the sum of the inverse distances */
+
+        /// Constructor with a zero sum
+        InverseDistanceSum() : total(0.0) {}
+
+        /**
+         * Add the inverse of a block of distances
+         * @param distSquared the squared distances
+         * @param count the number of squared distances
+         * @tparam S the type of the squared distances
+         */
+        template <class S>
+        void add(const S * distSquared, msize_type count)
+        {
+            for (msize_type j = 0; j < count; j++)
+            {
+                if (distSquared[j] != static_cast<S>(0))
+                {
+                    total += 1.0 / sqrt(static_cast<double>(distSquared[j]));
+                }
+            }
+        }
+
+        /**
+         * Add the sum of another set of pairs
+         * @param other the sum to add
+         */
+        void merge(const InverseDistanceSum & other)
+        {
+            total += other.total;
+        }
+    };
+
+    /**
+     * The minimum squared distance between points, for use with <code>reduceAllPairs</code>
+     */
+    struct MinimumDistanceSquared
+    {
+        double minimum; /**< the minimum squared distance, valid if <code>count > 0</code> */
+        msize_type count; /**< the number of distances seen */
+
+        /// Constructor with no distances
+        MinimumDistanceSquared() : minimum(0.0), count(0) {}
+
+        /**
+         * Include a block of distances in the minimum
+         * @param distSquared the squared distances
+         * @param n the number of squared distances
+         * @tparam S the type of the squared distances
+         */
+        template <class S>
+        void add(const S * distSquared, msize_type n)
+        {
+            for (msize_type j = 0; j < n; j++)
+            {
+                double d = static_cast<double>(distSquared[j]);
+                if (count == 0 || d < minimum)
+                {
+                    minimum = d;
+                }
+                count++;
+            }
+        }
+
+        /**
+         * Include the minimum of another set of pairs
+         * @param other the minimum to include
+         */
+        void merge(const MinimumDistanceSquared & other)
+        {
+            if (other.count > 0 && (count == 0 || other.minimum < minimum))
+            {
+                minimum = other.minimum;
+            }
+            count += other.count;
+        }
+    };
+
+    /**
+     * The number of points in one tile of the blocked all-pairs distances
+     * @param k the number of coordinates
+     * @param bytes the size of one coordinate
+     * @return the number of points, a multiple of 16 that fills about <code>LHS_DISTANCE_TILE_BYTES</code>
+     */
+    inline msize_type distanceTileRows(msize_type k, size_t bytes)
+    {
+        msize_type rows = LHS_DISTANCE_TILE_BYTES / (std::max<msize_type>(k, 1) * bytes);
+        return std::max<msize_type>(16, rows / 16 * 16);
+    }
+
+    /**
+     * Reduce the distances from the points in one tile to every later point,
+     * one tile of later points at a time so that both tiles stay in cache
+     * @param columns the <code>k x n</code> transpose of the points
+     * @param tile the number of points in a tile
+     * @param itile the tile of first points
+     * @param reducer the reduction of the squared distances
+     * @tparam T the type of the coordinates
+     * @tparam Reducer the reduction, see <code>reduceAllPairs</code>
+     */
+    template <class T, class Reducer>
+    void reduceTileRow(const bclib::alignedMatrix<T> & columns, msize_type tile, msize_type itile, Reducer & reducer)
+    {
+        typedef typename squaredDistanceType<T>::type S;
+        msize_type n = columns.colsize();
+        msize_type k = columns.rowsize();
+        msize_type ld = columns.leadingDimension();
+        msize_type first = itile * tile;
+        msize_type last = std::min(first + tile, n);
+        // the points of the first tile with contiguous coordinates
+        std::vector<T> points((last - first) * k);
+        for (msize_type i = first; i < last; i++)
+        {
+            for (msize_type c = 0; c < k; c++)
+            {
+                points[(i - first) * k + c] = columns(c, i);
+            }
+        }
+        std::vector<S> distSquared(tile);
+        for (msize_type jfirst = first; jfirst < n; jfirst += tile)
+        {
+            msize_type jlast = std::min(jfirst + tile, n);
+            for (msize_type i = first; i < last; i++)
+            {
+                msize_type start = std::max(jfirst, i + 1);
+                if (start >= jlast)
+                {
+                    continue;
+                }
+                distanceSquaredToBlock(points.data() + (i - first) * k, columns.row(0) + start, jlast - start,
+                    k, ld, distSquared.data());
+                reducer.add(distSquared.data(), jlast - start);
+            }
+        }
+    }
+
+    /**
+     * Reduce the squared distances between every pair of points with cache
+     * sized tiles, optionally in parallel
+     *
+     * The points are split into tiles of <code>distanceTileRows</code> points.
+     * For each tile of first points, the distances to the later points are
+     * computed one tile at a time and reduced into a partial result, and the
+     * partial results are merged in tile order.  The result is the same for
+     * any number of threads.  Floating point sums are grouped differently than
+     * in a single pass over the pairs, so they can differ in the last bits.
+     *
+     * A reducer is copy constructible and has the methods
+     * <code>void add(const S * distSquared, msize_type count)</code> and
+     * <code>void merge(const Reducer & other)</code>.
+     *
+     * @param columns the <code>k x n</code> transpose of the points, see <code>bclib::alignedMatrix::assignTranspose</code>
+     * @param initial the reducer before any distances are added
+     * @param nthreads the number of threads, 0 for <code>bclib::getMaxThreads()</code>
+     * @tparam T the type of the coordinates
+     * @tparam Reducer the reduction
+     * @return the reduction of all pairs
+     */
+    template <class T, class Reducer>
+    Reducer reduceAllPairs(const bclib::alignedMatrix<T> & columns, const Reducer & initial, unsigned int nthreads)
+    {
+        msize_type n = columns.colsize();
+        msize_type tile = distanceTileRows(columns.rowsize(), sizeof(T));
+        msize_type ntiles = (n + tile - 1) / tile;
+        std::vector<Reducer> partial(ntiles, initial);
+        if (nthreads == 0)
+        {
+            nthreads = bclib::getMaxThreads();
+        }
+        // the first tiles have the most pairs, so threads take the next tile as they finish
+        bclib::parallelForEach(ntiles, nthreads, [&columns, &partial, tile](size_t itile)
+        {
+            reduceTileRow(columns, tile, static_cast<msize_type>(itile), partial[itile]);
+        });
+        Reducer result = initial;
+        for (msize_type itile = 0; itile < ntiles; itile++)
+        {
+            result.merge(partial[itile]);
+        }
+        return result;
+    }
+
+    /**
+     * Reduce the squared distances between every pair of points with cache
+     * sized tiles, using up to <code>bclib::getMaxThreads()</code> threads
+     * when there are at least <code>LHS_DISTANCE_MIN_TILES_PER_THREAD</code>
+     * tiles per thread
+     * @param columns the <code>k x n</code> transpose of the points
+     * @param initial the reducer before any distances are added
+     * @tparam T the type of the coordinates
+     * @tparam Reducer the reduction, see <code>reduceAllPairs(const bclib::alignedMatrix<T> &, const Reducer &, unsigned int)</code>
+     * @return the reduction of all pairs
+     */
+    template <class T, class Reducer>
+    Reducer reduceAllPairs(const bclib::alignedMatrix<T> & columns, const Reducer & initial)
+    {
+        msize_type ntiles = (columns.colsize() + distanceTileRows(columns.rowsize(), sizeof(T)) - 1) /
+            distanceTileRows(columns.rowsize(), sizeof(T));
+        return reduceAllPairs(columns, initial, bclib::threadsForWork(ntiles, LHS_DISTANCE_MIN_TILES_PER_THREAD));
+    }
+
+    /**
+     * An upper bound on the squared distance between rows of a matrix
+     * @param A the matrix
+     * @param minimum the smallest element of the matrix, 0 if it is empty
+     * @param maximum the largest element of the matrix, 0 if it is empty
+     * @tparam T the type of object in the matrix
+     * @return the sum over the columns of the squared range of the column
+     */
+    template <class T>
+    double squaredDistanceBound(const bclib::matrix<T> & A, double & minimum, double & maximum)
+    {
+        double bound = 0.0;
+        minimum = 0.0;
+        maximum = 0.0;
+        for (msize_type jcol = 0; jcol < A.colsize(); jcol++)
+        {
+            double lo = 0.0;
+            double hi = 0.0;
+            for (msize_type irow = 0; irow < A.rowsize(); irow++)
+            {
+                double x = static_cast<double>(A(irow, jcol));
+                if (irow == 0 || x < lo)
+                {
+                    lo = x;
+                }
+                if (irow == 0 || x > hi)
+                {
+                    hi = x;
+                }
+            }
+            minimum = (jcol == 0 || lo < minimum) ? lo : minimum;
+            maximum = (jcol == 0 || hi > maximum) ? hi : maximum;
+            bound += (hi - lo) * (hi - lo);
+        }
+        return bound;
+    }
+
+    /**
+     * Can points with coordinates in a range be stored in 16 bit integers for
+     * the distance kernels, which subtract in 16 bits and accumulate the squared
+     * distances in unsigned 32 bits
+     * @param minimum the smallest coordinate
+     * @param maximum the largest coordinate
+     * @param bound an upper bound on the squared distance between points
+     * @return true if the coordinates and their differences fit in <code>int16_t</code>
+     * and the squared distances in <code>uint32_t</code>
+     */
+    inline bool isNarrowRange(double minimum, double maximum, double bound)
+    {
+        return minimum >= static_cast<double>(std::numeric_limits<int16_t>::min()) &&
+            maximum <= static_cast<double>(std::numeric_limits<int16_t>::max()) &&
+            maximum - minimum <= static_cast<double>(std::numeric_limits<int16_t>::max()) &&
+            bound <= static_cast<double>(std::numeric_limits<uint32_t>::max());
+    }
+
+    /**
+     * Can the rows of an integer matrix, such as a Latin hypercube with at most
+     * 32767 rows, be stored in 16 bit integers for the distance kernels
+     * @param A the matrix
+     * @tparam T the type of object in the matrix
+     * @return true if A is an integer matrix with a narrow range, see <code>isNarrowRange</code>
+     */
+    template <class T>
+    bool isNarrowDesign(const bclib::matrix<T> & A)
+    {
+        if (!std::is_integral<T>::value)
+        {
+            return false;
+        }
+        double minimum;
+        double maximum;
+        double bound = squaredDistanceBound(A, minimum, maximum);
+        return isNarrowRange(minimum, maximum, bound);
+    }
+
+    /**
+     * Reduce the squared distances between every pair of rows of a matrix with
+     * the blocked all-pairs distances.  Integer matrices with a narrow range are
+     * copied to 16 bit integers, which halves the memory traffic and doubles
+     * the points per SIMD register.  Integer matrices whose squared distances
+     * could overflow the integer type, as in designs with tens of thousands of
+     * rows, are computed in double precision, which is exact for integers up to 2^53
+     * @param A the matrix
+     * @param initial the reducer before any distances are added
+     * @tparam T the type of object in the matrix
+     * @tparam Reducer the reduction, see <code>reduceAllPairs(const bclib::alignedMatrix<T> &, const Reducer &, unsigned int)</code>
+     * @return the reduction of all pairs
+     */
+    template <class T, class Reducer>
+    Reducer reduceAllPairs(const bclib::matrix<T> & A, const Reducer & initial)
+    {
+        typedef typename squaredDistanceType<T>::type S;
+        if (std::is_integral<T>::value)
+        {
+            double minimum;
+            double maximum;
+            double bound = squaredDistanceBound(A, minimum, maximum);
+            if (isNarrowRange(minimum, maximum, bound))
+            {
+                bclib::alignedMatrix<int16_t> columns;
+                columns.assignTranspose(A);
+                return reduceAllPairs(columns, initial);
+            }
+            if (bound > static_cast<double>(std::numeric_limits<S>::max()))
+            {
+                bclib::alignedMatrix<double> columns;
+                columns.assignTranspose(A);
+                return reduceAllPairs(columns, initial);
+            }
+        }
+        bclib::alignedMatrix<T> columns;
+        columns.assignTranspose(A);
+        return reduceAllPairs(columns, initial);
+    }
+} // end namespace
+
+#endif	/* BLOCKEDDISTANCE_H */
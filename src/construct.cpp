@@ -29,6 +29,7 @@
  */
 
 #include "construct.h"
+#include "OARowGenerator.h"
 
 namespace oacpp
 {
@@ -50,32 +51,11 @@ namespace oacpp
             return SUCCESS_CHECK;
         }
 
-        int bose(GaloisField & gf, bclib::matrix<int> & A, int ncol)
+        int bose(const GaloisField & gf, bclib::matrix<int> & A, int ncol)
         {
-            size_t icol, irow;
-
-            // bosecheck throws if it fails
-            bosecheck(gf.q, ncol);
-
-            irow = 0;
-            for (size_t i = 0; i < gf.u_q; i++)
-            {
-                for (size_t j = 0; j < gf.u_q; j++)
-                {
-                    icol = 0;
-                    A(irow, icol++) = static_cast<int>(i);
-                    if (ncol > 1)
-                    {
-                        A(irow, icol++) = static_cast<int>(j);
-                    }
-                    for (icol = 2; icol < static_cast<size_t>(ncol); icol++)
-                    {
-                        A(irow, icol) = gf.plus(j, gf.times(i, icol - 1));
-                    }
-                    irow++;
-                }
-            }
-
+            // the generator checks the inputs and throws if they fail
+            BoseRowGenerator generator(gf, ncol);
+            generator.fill(A);
             return SUCCESS_CHECK;
         }
 
@@ -91,7 +71,7 @@ namespace oacpp
 
         /*  find  value = poly(arg) where poly is a polynomial of degree d  
             and all the arithmetic takes place in the given Galois field.*/
-        int polyeval(GaloisField & gf, int d, std::vector<int> & poly, int arg, int* value)
+        int polyeval(const GaloisField & gf, int d, std::vector<int> & poly, int arg, int* value)
         {
             int ans = 0;
             /* note: cannot decrement with a size type because it is always > 0.  this needs to go < 1 to stop */
@@ -101,16 +81,15 @@ namespace oacpp
                 size_t ui = static_cast<size_t>(i);
                 size_t uans = static_cast<size_t>(ans);
                 size_t uarg = static_cast<size_t>(arg);
+                // GaloisField::plus and GaloisField::times check the range when RANGE_DEBUG is defined
+                //ans = gf.plus(gf.times(ans,arg),poly[i]);
+                size_t plusRow = static_cast<size_t>(gf.times(uans,uarg));
     #ifdef RANGE_DEBUG
-                size_t plusRow = static_cast<size_t>(gf.times.at(uans,uarg));
                 size_t plusCol = static_cast<size_t>(poly.at(ui));
-                ans = gf.plus.at(plusRow, plusCol);
     #else
-                //ans = gf.plus(gf.times(ans,arg),poly[i]);
-                size_t plusRow = static_cast<size_t>(gf.times(uans,uarg));
                 size_t plusCol = static_cast<size_t>(poly[ui]);
-                ans = gf.plus(plusRow, plusCol);
     #endif
+                ans = gf.plus(plusRow, plusCol);
             }
 
             *value = ans;
@@ -134,24 +113,11 @@ namespace oacpp
             return SUCCESS_CHECK;
         }
 
-        int bush(GaloisField & gf, bclib::matrix<int> & A, int str, int ncol)
+        int bush(const GaloisField & gf, bclib::matrix<int> & A, int str, int ncol)
         {
-            std::vector<int> coef(str);
-            
-            // bushcheck throws if it fails
-            bushcheck(gf.q, str, ncol);
-
-            size_t qToStr = static_cast<size_t>(primes::ipow(gf.q, str));
-
-            for (size_t i = 0; i < qToStr; i++)
-            {
-                itopoly(static_cast<int>(i), gf.q, str - 1, coef);
-                A(i, static_cast<size_t>(0)) = coef[static_cast<size_t>(str) - 1];
-                for (size_t j = 0; j < static_cast<size_t>(ncol) - 1; j++)
-                {
-                    polyeval(gf, str - 1, coef, static_cast<int>(j), &(A(i, 1 + j)));
-                }
-            }
+            // the generator checks the inputs and throws if they fail
+            BushRowGenerator generator(gf, str, ncol);
+            generator.fill(A);
             return SUCCESS_CHECK;
         }
 
@@ -177,90 +143,11 @@ namespace oacpp
             return SUCCESS_CHECK;
         }
 
-        int addelkemp(GaloisField & gf, bclib::matrix<int> & A, int ncol)
+        int addelkemp(const GaloisField & gf, bclib::matrix<int> & A, int ncol)
         {
-            int kay; /* A&K notation */
-            int square, ksquare, temp;
-			size_t row, col;
-            size_t u_ncol = static_cast<size_t>(ncol);
-
-            std::vector<int> b(gf.u_q);
-            std::vector<int> c(gf.u_q);
-            std::vector<int> k(gf.u_q);
-
-            // addelkempcheck throws if it fails
-            addelkempcheck(gf.q, gf.p, ncol);
-
-            for (size_t i = 0; i < gf.u_q; i++)
-            { /* First q*q rows */
-                square = gf.times(i,i);
-                for (size_t j = 0; j < gf.u_q; j++)
-                {
-                    row = i * gf.u_q + j;
-                    col = 0;
-                    if (col < u_ncol)
-                    {
-                        A(row, col++) = static_cast<int>(j);
-                    }
-                    for (size_t m = 1; m < gf.u_q && col < u_ncol; m++)
-                    {
-                        A(row,col++) = gf.plus(i,gf.times(m,j));
-                    }
-                    for (size_t m = 0; m < gf.u_q && col < u_ncol; m++)
-                    {
-                        temp = gf.plus(j,gf.times(m,i));
-                        A(row,col++) = gf.plus(temp,square); /* Rgt cols */
-                    }
-                    if (col < u_ncol)
-                    {
-                        A(row, col++) = static_cast<int>(i);
-                    }
-                }
-            }
-
-            if (gf.p != 2) /* Constants kay,b,c,k for odd p */
-            {
-                oaaddelkemp::akodd(gf, &kay, b, c, k);
-            }
-            else /* Constants kay,b,c,k for even p */
-            {
-                oaaddelkemp::akeven(gf, &kay, b, c, k);
-            }
-
-            for (size_t i = 0; i < gf.u_q; i++)
-            { /* Second q*q rows */
-                square = gf.times(i,i);
-                ksquare = gf.times(kay,square);
-                for (size_t j = 0; j < gf.u_q; j++)
-                {
-                    row = gf.u_q * gf.u_q + i * gf.u_q + j;
-                    col = 0;
-                    if (col < u_ncol)
-                    {
-                        A(row, col++) = static_cast<int>(j);
-                    }
-                    for (size_t m = 1; m < gf.u_q && col < u_ncol; m++, col++)
-                    {
-                        A(row,col) = gf.plus(A(row - gf.u_q * gf.u_q, col), b[m]);
-                    }
-                    if (col < u_ncol)
-                    {
-                        A(row,col++) = gf.plus(ksquare,j); /* q+1 */
-                    }
-                    for (size_t m = 1; m < gf.u_q && col < u_ncol; m++)
-                    {
-                        temp = gf.times(i,k[m]);
-                        temp = gf.plus(ksquare,temp);
-                        temp = gf.plus(j,temp);
-                        A(row,col++) = gf.plus(temp,c[m]);
-                    }
-                    if (col < u_ncol)
-                    {
-                        A(row, col++) = static_cast<int>(i);
-                    }
-                }
-            }
-
+            // the generator checks the inputs and throws if they fail
+            AddelkempRowGenerator generator(gf, ncol);
+            generator.fill(A);
             return SUCCESS_CHECK;
         }
 
@@ -283,7 +170,7 @@ namespace oacpp
             return SUCCESS_CHECK;
         }
 
-        int bosebush(GaloisField & gf, bclib::matrix<int> & B, int ncol)
+        int bosebush(const GaloisField & gf, bclib::matrix<int> & B, int ncol)
         {
             int mul;
 			size_t irow;
@@ -347,7 +234,7 @@ namespace oacpp
             return SUCCESS_CHECK;
         }
 
-        int bosebushl(GaloisField & gf, int lam, bclib::matrix<int> & B, int ncol)
+        int bosebushl(const GaloisField & gf, int lam, bclib::matrix<int> & B, int ncol)
         /* Implement Bose and Bush's 1952 A.M.S. method with given lambda */
         {
             int irow;
@@ -54,7 +54,7 @@ namespace oacpp {
          * @param ncol the number of columns
          * @return an indicator of success
          */
-		int bose(GaloisField & gf, bclib::matrix<int> & A, int ncol );
+		int bose(const GaloisField & gf, bclib::matrix<int> & A, int ncol );
         
         /**
          * Construct an orthogonal array using the bush algorithm
@@ -64,7 +64,7 @@ namespace oacpp {
          * @param ncol the desired number of columns
          * @return an indicator of success
          */
-		int bush(GaloisField & gf, bclib::matrix<int> &  A, int str, int ncol  );
+		int bush(const GaloisField & gf, bclib::matrix<int> &  A, int str, int ncol  );
         
         /**
          * Implement Addelman and Kempthorne's 1961 A.M.S. method with n=2
@@ -74,7 +74,7 @@ namespace oacpp {
          * @param ncol the desired number of columns
          * @return an indicator of success
          */
-		int addelkemp(GaloisField & gf, bclib::matrix<int> & A, int ncol );
+		int addelkemp(const GaloisField & gf, bclib::matrix<int> & A, int ncol );
         
         /**
          * Construct an orthogonal array using the bosebush algorithm
@@ -87,7 +87,7 @@ namespace oacpp {
          * @param ncol the desired number of columns
          * @return an indicator of success
          */
-		int bosebush(GaloisField & gf, bclib::matrix<int> & B, int ncol );
+		int bosebush(const GaloisField & gf, bclib::matrix<int> & B, int ncol );
         
         /**
          * Construct an orthogonal array using the bose-bush algorithm
@@ -98,7 +98,7 @@ namespace oacpp {
          * @param ncol the desired number of columns
          * @return an indicator of success
          */
-		int bosebushl(GaloisField & gf, int lam, bclib::matrix<int> & B, int ncol );
+		int bosebushl(const GaloisField & gf, int lam, bclib::matrix<int> & B, int ncol );
 
         /**
          * Check the input to the bose algorithm
@@ -128,7 +128,7 @@ namespace oacpp {
          * @param value the result
          * @return an indicator of success
          */
-		int polyeval(GaloisField & gf, int d, std::vector<int> & poly, int arg, int* value );
+		int polyeval(const GaloisField & gf, int d, std::vector<int> & poly, int arg, int* value );
         
         /**
          * Test the inputs to the Bush algorithm 
@@ -23,9 +23,16 @@
 
 namespace lhslib 
 {
-    // TODO: multi-thread the iterations over population
     void geneticLHS(int n, int k, int pop, int gen, double pMut, const std::string & criterium,
             bool bVerbose, bclib::matrix<double> & result, bclib::CRandom<double> & oRandom)
+    {
+        geneticLHS(n, k, pop, gen, pMut, criterium, bVerbose, result, oRandom, NULL);
+    }
+
+    // TODO: multi-thread the iterations over population
+    void geneticLHS(int n, int k, int pop, int gen, double pMut, const std::string & criterium,
+            bool bVerbose, bclib::matrix<double> & result, bclib::CRandom<double> & oRandom,
+            bclib::RunStatistics * stats)
     {
         if (n < 1 || k < 1)
         {
@@ -53,6 +60,11 @@ namespace lhslib
             throw std::invalid_argument("pop should be an even number");
         }
 
+        bclib::PhaseTimer initializeTimer(stats, "initialize");
+        bclib::CountingRandom countedRandom(oRandom);
+        // draw through the counter only when the statistics are requested
+        bclib::CRandom<double> & drawRandom = (stats != NULL) ?
+            static_cast<bclib::CRandom<double> &>(countedRandom) : oRandom;
         std::vector<bclib::matrix<int> > A = std::vector<bclib::matrix<int> >(m_pop);
         for (msize_type i = 0; i < m_pop; i++)
         {
@@ -62,16 +74,26 @@ namespace lhslib
         for (msize_type i = 0; i < m_pop; i++)
         {
             // fill A with random hypercubes
-            randomLHS(static_cast<int>(m_n), static_cast<int>(m_k), A[i], oRandom);
+            randomLHS(static_cast<int>(m_n), static_cast<int>(m_k), A[i], drawRandom);
 #ifdef _DEBUG
             if (!lhslib::isValidLHS(A[i])) PRINT_MACRO("A is not valid at %d in randomLHS\n", static_cast<int>(i));
 #endif
         }
         std::vector<double> B;
-        std::vector<bclib::matrix<int> > J;
-        bclib::matrix<double> dist;
-        std::vector<double>::iterator it;
-        std::vector<double> distnonzero = std::vector<double>();
+        // the next generation, every member is overwritten in each generation
+        std::vector<bclib::matrix<int> > J = std::vector<bclib::matrix<int> >(m_pop);
+        for (std::vector<bclib::matrix<int> >::iterator i = J.begin(); i != J.end(); ++i)
+        {
+            *i = bclib::matrix<int>(m_n, m_k);
+        }
+        InverseDistanceTable invDistance(n, k);
+        if (stats != NULL)
+        {
+            stats->addAllocation<int>(2 * m_pop * m_n * m_k);
+            stats->addAllocation<double>(invDistance.size());
+        }
+        initializeTimer.stop();
+        bclib::PhaseTimer evolveTimer(stats, "evolve");
         for (msize_type v = 0; v < m_gen; v++)
         {
             B = std::vector<double>(m_pop);
@@ -79,24 +101,12 @@ namespace lhslib
             {
                 if (criterium == "S")
                 {
-                    B[i] = calculateSOptimal<int>(A[i]);
+                    B[i] = calculateSOptimal(A[i], invDistance);
                 }
                 else if (criterium == "Maximin")
                 {
                     //B[i] <- min(dist(A[, , i]))
-                    dist = bclib::matrix<double>(A[i].rowsize(), A[i].rowsize());
-                    calculateDistance<int>(A[i], dist);
-                    // we want to find the minimum distance element, but there are zeros in the dist matrix
-                    distnonzero.clear();
-                    for (bclib::matrix<double>::const_iterator mit = dist.begin(); mit != dist.end(); ++mit)
-                    {
-                        if (*mit > 0.0)
-                        {
-                            distnonzero.push_back(*mit);
-                        }
-                    }
-                    it = std::min_element(distnonzero.begin(), distnonzero.end());
-                    B[i] = *it;
+                    B[i] = minimumDistance(A[i]);
                 } 
                 else 
                 {
@@ -110,12 +120,15 @@ namespace lhslib
             std::vector<int> H = std::vector<int>(B.size());
             bclib::findorder_zero(B, H);
             int posit = static_cast<int>(std::max_element(B.begin(), B.end()) - B.begin());
-
-            J = std::vector<bclib::matrix<int> >(m_pop);
-            for (std::vector<bclib::matrix<int> >::iterator i = J.begin(); i != J.end(); ++i)
+            if (stats != NULL)
             {
-                *i = bclib::matrix<int>(m_n, m_k);
+                stats->criterionEvaluations += m_pop;
+                stats->candidatesScored += m_pop;
+                stats->addAllocation<double>(m_pop + m_k);
+                stats->addAllocation<int>(m_pop);
+                stats->criterionTrajectory.push_back(B[posit]);
             }
+
 #ifdef _DEBUG
             if (!lhslib::isValidLHS(A[posit])) PRINT_MACRO("A is not valid at %d in randomLHS\n", static_cast<int>(posit));
 #endif
@@ -126,6 +139,7 @@ namespace lhslib
             }
             if (m_pop / 2 == 1)
             {
+                A.swap(J);
                 break;
             }
             // the second half of the next population gets the decreasingly best hypercubes from the first population
@@ -155,8 +169,8 @@ namespace lhslib
             // in the others in the first half of the population, randomly permute a column from the second half into the first half
             for (msize_type i = 1; i < (m_pop / 2); i++)
             {
-                runifint<int>(0, static_cast<int>(m_k)-1, &temp1, oRandom);
-                runifint<int>(0, static_cast<int>(m_k)-1, &temp2, oRandom);
+                runifint<int>(0, static_cast<int>(m_k)-1, &temp1, drawRandom);
+                runifint<int>(0, static_cast<int>(m_k)-1, &temp2, drawRandom);
                 for (msize_type irow = 0; irow < m_n; irow++)
                 {
                     J[i](irow, temp1) = J[i + m_pop / 2](irow, temp2);
@@ -173,8 +187,8 @@ namespace lhslib
             // for the second half of the population, randomly permute a column from the best hypercube
             for (msize_type i = m_pop / 2; i < m_pop; i++)
             {
-                runifint<int>(0, static_cast<int>(m_k)-1, &temp1, oRandom);
-                runifint<int>(0, static_cast<int>(m_k)-1, &temp2, oRandom);
+                runifint<int>(0, static_cast<int>(m_k)-1, &temp1, drawRandom);
+                runifint<int>(0, static_cast<int>(m_k)-1, &temp2, drawRandom);
                 for (msize_type irow = 0; irow < m_n; irow++)
                 {
                     J[i](irow, temp1) = A[posit](irow, temp2);
@@ -188,45 +202,55 @@ namespace lhslib
             std::vector<double> y = std::vector<double>(m_k);
             for (msize_type i = 1; i < m_pop; i++)
             {
-                runif_std(static_cast<unsigned int>(m_k), y, oRandom);
+                runif_std(static_cast<unsigned int>(m_k), y, drawRandom);
                 for (msize_type j = 0; j < m_k; j++)
                 {
                     if (y[j] <= pMut)
                     {
                         std::vector<int> z = std::vector<int>(2);
-                        runifint<int>(2u, 0, static_cast<int>(m_n-1), z, oRandom);
+                        runifint<int>(2u, 0, static_cast<int>(m_n-1), z, drawRandom);
                         int a = J[i](z[0], j);
                         int b = J[i](z[1], j);
                         J[i](z[0], j) = b;
                         J[i](z[1], j) = a;
+                        if (stats != NULL)
+                        {
+                            stats->acceptedMoves++;
+                        }
                     }
                 }
             }
-            // put all of J back into A to start the next round
-            A = J;
+            // J becomes the population for the next round, A is reused as the next J
+            A.swap(J);
             if (v != m_gen && bVerbose)
             {
 				PRINT_MACRO << "Generation " << v << " completed\n"; // LCOV_EXCL_LINE
             }
         }
 
+        evolveTimer.stop();
         if (bVerbose)
         {
 			PRINT_MACRO << "Last generation completed\n"; // LCOV_EXCL_LINE
         }
 #ifdef _DEBUG
-        if (!lhslib::isValidLHS(J[0])) PRINT_MACRO("J[0] is not valid\n");
+        if (!lhslib::isValidLHS(A[0])) PRINT_MACRO("A[0] is not valid\n");
 #endif
         std::vector<double> eps = std::vector<double>(m_n*m_k);
-        runif_std(static_cast<unsigned int>(m_n * m_k), eps, oRandom);
+        runif_std(static_cast<unsigned int>(m_n * m_k), eps, drawRandom);
         unsigned int count = 0;
         for (unsigned int j = 0; j < static_cast<unsigned int>(m_k); j++)
         {
             for (unsigned int i = 0; i < static_cast<unsigned int>(m_n); i++)
             {
-                result(i,j) = (static_cast<double>(J[0](i,j)) - 1.0 + eps[count]) / static_cast<double>(m_n);
+                result(i,j) = (static_cast<double>(A[0](i,j)) - 1.0 + eps[count]) / static_cast<double>(m_n);
                 count++;
             }
         }
+        if (stats != NULL)
+        {
+            stats->addAllocation<double>(m_n * m_k);
+            stats->randomDraws += countedRandom.draws();
+        }
     }
 }
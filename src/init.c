@@ -10,6 +10,8 @@
 /* .Call calls */
 extern SEXP create_galois_field(SEXP);
 extern SEXP create_oalhs(SEXP, SEXP, SEXP, SEXP);
+extern SEXP galois_field_cache_info(void);
+extern SEXP galois_field_cache_limit(SEXP);
 extern SEXP geneticLHS_cpp(SEXP, SEXP, SEXP, SEXP, SEXP, SEXP, SEXP);
 extern SEXP get_library_versions(void);
 extern SEXP improvedLHS_cpp(SEXP, SEXP, SEXP);
@@ -27,6 +29,8 @@ extern SEXP randomLHS_cpp(SEXP, SEXP, SEXP);
 static const R_CallMethodDef CallEntries[] = {
     {"create_galois_field",  (DL_FUNC) &create_galois_field,  1},
     {"create_oalhs",         (DL_FUNC) &create_oalhs,         4},
+    {"galois_field_cache_info",  (DL_FUNC) &galois_field_cache_info,  0},
+    {"galois_field_cache_limit", (DL_FUNC) &galois_field_cache_limit, 1},
     {"geneticLHS_cpp",       (DL_FUNC) &geneticLHS_cpp,       7},
     {"get_library_versions", (DL_FUNC) &get_library_versions, 0},
     {"improvedLHS_cpp",      (DL_FUNC) &improvedLHS_cpp,      3},
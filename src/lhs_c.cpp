@@ -0,0 +1,736 @@
+/**
+ * @file lhs_c.cpp
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <new>
+#include <stdexcept>
+#include <string>
+#include "lhs_c.h"
+#include "LHSCommonDefines.h"
+#include "COrthogonalArray.h"
+#include "oaLHS.h"
+#include "oaPlanner.h"
+#include "lhslibVersion.h"
+#include "RunStatistics.h"
+#include "parallelFor.h"
+
+/**
+ * The statistics collector of the C interface
+ */
+struct lhs_statistics
+{
+    bclib::RunStatistics stats; /**< the statistics */
+};
+
+namespace lhs_c
+{
+    /**
+     * An argument error of the C interface, reported as <code>LHS_ERROR_ARGUMENT</code>
+     */
+    class argument_error : public std::invalid_argument
+    {
+    public:
+        /**
+         * Constructor
+         * @param msg the message
+         */
+        explicit argument_error(const std::string & msg) : std::invalid_argument(msg) {}
+    };
+
+    /**
+     * An output buffer that is too small, reported as <code>LHS_ERROR_BUFFER</code>
+     */
+    class buffer_error : public std::length_error
+    {
+    public:
+        /**
+         * Constructor
+         * @param msg the message
+         */
+        explicit buffer_error(const std::string & msg) : std::length_error(msg) {}
+    };
+
+    /**
+     * The message of the last failure on this thread
+     * @return a reference to the message
+     */
+    static std::string & lastError()
+    {
+        static thread_local std::string message;
+        return message;
+    }
+
+    /**
+     * The statistics collector attached to this thread
+     * @return a reference to the collector, NULL if none is attached
+     */
+    static lhs_statistics *& threadStatistics()
+    {
+        static thread_local lhs_statistics * stats = NULL;
+        return stats;
+    }
+
+    /**
+     * The statistics of the calls on this thread
+     * @return the statistics, NULL if no collector is attached
+     */
+    static bclib::RunStatistics * currentStatistics()
+    {
+        lhs_statistics * collector = threadStatistics();
+        return (collector == NULL) ? NULL : &collector->stats;
+    }
+
+    /**
+     * Run a call, converting its exceptions to a status
+     * @param f the call
+     * @return the status
+     * @tparam F a function object with no arguments
+     */
+    template <class F>
+    static lhs_status guard(F f)
+    {
+        try
+        {
+            f();
+            return LHS_OK;
+        }
+        catch (std::invalid_argument & e)
+        {
+            // argument_error and the argument checks of the engines
+            lastError() = e.what();
+            return LHS_ERROR_ARGUMENT;
+        }
+        catch (buffer_error & e)
+        {
+            lastError() = e.what();
+            return LHS_ERROR_BUFFER;
+        }
+        catch (std::bad_alloc &)
+        {
+            lastError() = "memory could not be allocated"; // LCOV_EXCL_LINE
+            return LHS_ERROR_MEMORY; // LCOV_EXCL_LINE
+        }
+        catch (std::exception & e)
+        {
+            lastError() = e.what();
+            return LHS_ERROR_RUNTIME;
+        }
+        catch (...)
+        {
+            lastError() = "unknown error"; // LCOV_EXCL_LINE
+            return LHS_ERROR_RUNTIME; // LCOV_EXCL_LINE
+        }
+    }
+
+    /**
+     * A CRandom that draws from the callback of the caller
+     */
+    class CallbackUniform : public bclib::CRandom<double>
+    {
+    public:
+        /**
+         * Constructor
+         * @param rng the generator of the caller
+         * @throws argument_error if the generator or its callback is null
+         */
+        explicit CallbackUniform(const lhs_rng * rng)
+        {
+            if (rng == NULL || rng->uniform == NULL)
+            {
+                throw argument_error("the random number generator and its uniform callback may not be NULL");
+            }
+            m_rng = *rng;
+        }
+
+        /**
+         * get the next random number from the callback
+         * @return the random deviate
+         */
+        double getNextRandom()
+        {
+            return m_rng.uniform(m_rng.state);
+        }
+
+    private:
+        lhs_rng m_rng; /**< the generator of the caller */
+    };
+
+    /**
+     * Check the size of a design and its buffer
+     * @param n the number of rows
+     * @param k the number of columns
+     * @param design the buffer
+     * @throws argument_error if the size is not positive or the buffer is null
+     */
+    static void checkDesign(int n, int k, const void * design)
+    {
+        if (n < 1 || k < 1)
+        {
+            throw argument_error("n and k must be integers > 0");
+        }
+        if (design == NULL)
+        {
+            throw argument_error("the design buffer may not be NULL");
+        }
+    }
+
+    /**
+     * Check the arguments of the optimum Latin hypercube algorithms
+     * @param max_sweeps the maximum number of sweeps of the optimization
+     * @param eps the optimal stopping criterion
+     * @throws argument_error if max_sweeps is less than 1 or eps is not on (0,1)
+     */
+    static void checkOptimumArguments(int max_sweeps, double eps)
+    {
+        if (max_sweeps < 1)
+        {
+            throw argument_error("max_sweeps must be an integer > 0");
+        }
+        if (!(eps > 0.0 && eps < 1.0))
+        {
+            throw argument_error("eps must be a double on the interval (0,1)");
+        }
+    }
+
+    /**
+     * Check the number of candidate points of the improved and maximin algorithms
+     * @param dup the number of candidate points for each point in the sample
+     * @throws argument_error if dup is less than 1
+     */
+    static void checkDuplication(int dup)
+    {
+        if (dup < 1)
+        {
+            throw argument_error("dup must be an integer > 0");
+        }
+    }
+
+    /**
+     * Run an orthogonal array construction
+     * @param coa the array
+     * @param type the construction
+     * @param q the number of symbols in each column
+     * @param k the number of columns
+     * @param param the parameter of the construction
+     * @param n the number of rows on return
+     * @throws argument_error if the construction is unknown
+     */
+    static void constructOA(oacpp::COrthogonalArray & coa, lhs_oa_type type, int q, int k, int param, int * n)
+    {
+        switch (type)
+        {
+        case LHS_OA_ADDELKEMP:
+            coa.addelkemp(q, k, n);
+            break;
+        case LHS_OA_ADDELKEMP3:
+            coa.addelkemp3(q, k, n);
+            break;
+        case LHS_OA_ADDELKEMPN:
+            coa.addelkempn(param, q, k, n);
+            break;
+        case LHS_OA_BOSE:
+            coa.bose(q, k, n);
+            break;
+        case LHS_OA_BOSEBUSH:
+            coa.bosebush(q, k, n);
+            break;
+        case LHS_OA_BOSEBUSHL:
+            coa.bosebushl(param, q, k, n);
+            break;
+        case LHS_OA_BUSH:
+            coa.bush(q, k, n);
+            break;
+        case LHS_OA_BUSHT:
+            coa.busht(param, q, k, n);
+            break;
+        default:
+            throw argument_error("unknown orthogonal array type");
+        }
+    }
+
+    /**
+     * Fill a design with a single point, the case the algorithms do not handle
+     * @param k the number of columns
+     * @param oRandom the random number generator
+     * @param design the 1 x k design
+     */
+    static void degenerateCase(int k, bclib::CRandom<double> & oRandom, double * design)
+    {
+        for (int j = 0; j < k; j++)
+        {
+            design[j] = oRandom.getNextRandom();
+        }
+    }
+
+    /**
+     * Copy a matrix to a column-major buffer
+     * @param mat the matrix
+     * @param out the buffer of <code>mat.rowsize() * mat.colsize()</code> elements
+     * @tparam T the type of the elements
+     */
+    template <class T>
+    static void copyByColumn(const bclib::matrix<T> & mat, T * out)
+    {
+        size_t rows = mat.rowsize();
+        for (size_t j = 0; j < mat.colsize(); j++)
+        {
+            for (size_t i = 0; i < rows; i++)
+            {
+                out[i + j * rows] = mat(i, j);
+            }
+        }
+    }
+
+    /**
+     * Convert an integer Latin hypercube to a sample on the unit hypercube,
+     * drawing the uniform deviates in column order
+     * @param intMat the Latin hypercube with values 1 to n in each column
+     * @param oRandom the random number generator
+     * @param design the sample by column
+     * @param stats the statistics of the call, or NULL
+     */
+    static void convertIntegerToNumeric(const bclib::matrix<int> & intMat, bclib::CRandom<double> & oRandom,
+        double * design, bclib::RunStatistics * stats)
+    {
+        bclib::PhaseTimer timer(stats, "convert");
+        size_t rows = intMat.rowsize();
+        for (size_t j = 0; j < intMat.colsize(); j++)
+        {
+            for (size_t i = 0; i < rows; i++)
+            {
+                design[i + j * rows] = (static_cast<double>(intMat(i, j) - 1) + oRandom.getNextRandom()) /
+                    static_cast<double>(rows);
+            }
+        }
+        if (stats != NULL)
+        {
+            stats->randomDraws += rows * intMat.colsize();
+        }
+    }
+
+    /**
+     * The length of the optimality record used by the optimum Latin hypercube algorithms
+     * @param n the number of rows
+     * @return n choose 2 plus 1
+     */
+    static int optimalityRecordLength(int n)
+    {
+        return static_cast<int>(static_cast<long long>(n) * (n - 1) / 2 + 1);
+    }
+} // end namespace
+
+extern "C"
+{
+
+int lhs_api_version(void)
+{
+    return LHS_C_API_VERSION;
+}
+
+const char * lhs_version(void)
+{
+    return lhslib::getVersion();
+}
+
+const char * lhs_last_error(void)
+{
+    return lhs_c::lastError().c_str();
+}
+
+lhs_status lhs_set_max_threads(int nthreads)
+{
+    return lhs_c::guard([=]() {
+        if (nthreads < 0)
+        {
+            throw lhs_c::argument_error("nthreads must be an integer >= 0");
+        }
+        bclib::setMaxThreads(static_cast<unsigned int>(nthreads));
+    });
+}
+
+int lhs_get_max_threads(void)
+{
+    return static_cast<int>(bclib::getMaxThreads());
+}
+
+lhs_status lhs_random(int n, int k, int preserve_draw, const lhs_rng * rng, double * design)
+{
+    return lhs_c::guard([=]() {
+        lhs_c::checkDesign(n, k, design);
+        lhs_c::CallbackUniform oRandom(rng);
+        if (n == 1)
+        {
+            lhs_c::degenerateCase(k, oRandom, design);
+            return;
+        }
+        bclib::matrix<double> result = bclib::matrix<double>(n, k);
+        lhslib::randomLHS(n, k, preserve_draw != 0, result, oRandom);
+        lhs_c::copyByColumn(result, design);
+    });
+}
+
+lhs_status lhs_improved(int n, int k, int dup, const lhs_rng * rng, double * design)
+{
+    return lhs_c::guard([=]() {
+        lhs_c::checkDesign(n, k, design);
+        lhs_c::checkDuplication(dup);
+        lhs_c::CallbackUniform oRandom(rng);
+        if (n == 1)
+        {
+            lhs_c::degenerateCase(k, oRandom, design);
+            return;
+        }
+        bclib::matrix<int> intMat = bclib::matrix<int>(n, k);
+        bclib::RunStatistics * stats = lhs_c::currentStatistics();
+        lhslib::improvedLHS(n, k, dup, intMat, oRandom, stats);
+        lhs_c::convertIntegerToNumeric(intMat, oRandom, design, stats);
+    });
+}
+
+lhs_status lhs_maximin(int n, int k, int dup, const lhs_rng * rng, double * design)
+{
+    return lhs_c::guard([=]() {
+        lhs_c::checkDesign(n, k, design);
+        lhs_c::checkDuplication(dup);
+        lhs_c::CallbackUniform oRandom(rng);
+        if (n == 1)
+        {
+            lhs_c::degenerateCase(k, oRandom, design);
+            return;
+        }
+        bclib::matrix<int> intMat = bclib::matrix<int>(n, k);
+        bclib::RunStatistics * stats = lhs_c::currentStatistics();
+        lhslib::maximinLHS(n, k, dup, intMat, oRandom, stats);
+        lhs_c::convertIntegerToNumeric(intMat, oRandom, design, stats);
+    });
+}
+
+lhs_status lhs_optimum(int n, int k, int max_sweeps, double eps, int verbose,
+    const lhs_rng * rng, double * design)
+{
+    return lhs_c::guard([=]() {
+        lhs_c::checkDesign(n, k, design);
+        lhs_c::checkOptimumArguments(max_sweeps, eps);
+        lhs_c::CallbackUniform oRandom(rng);
+        if (n == 1)
+        {
+            lhs_c::degenerateCase(k, oRandom, design);
+            return;
+        }
+        bclib::matrix<int> intMat = bclib::matrix<int>(n, k);
+        bclib::RunStatistics * stats = lhs_c::currentStatistics();
+        lhslib::optimumLHS(n, k, max_sweeps, eps, intMat, lhs_c::optimalityRecordLength(n),
+            oRandom, verbose != 0, stats);
+        lhs_c::convertIntegerToNumeric(intMat, oRandom, design, stats);
+    });
+}
+
+lhs_status lhs_optimum_seeded(int n, int k, int max_sweeps, double eps, int verbose,
+    double * design)
+{
+    return lhs_c::guard([=]() {
+        lhs_c::checkDesign(n, k, design);
+        lhs_c::checkOptimumArguments(max_sweeps, eps);
+        if (n == 1)
+        {
+            return;
+        }
+        bclib::matrix<double> mat = bclib::matrix<double>(n, k);
+        for (int j = 0; j < k; j++)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                mat(i, j) = design[i + j * n];
+            }
+        }
+        lhslib::optSeededLHS(n, k, max_sweeps, eps, mat, lhs_c::optimalityRecordLength(n), verbose != 0,
+            lhs_c::currentStatistics());
+        lhs_c::copyByColumn(mat, design);
+    });
+}
+
+lhs_status lhs_genetic(int n, int k, int pop, int gen, double pmut, const char * criterium,
+    int verbose, const lhs_rng * rng, double * design)
+{
+    return lhs_c::guard([=]() {
+        lhs_c::checkDesign(n, k, design);
+        if (criterium == NULL)
+        {
+            throw lhs_c::argument_error("criterium may not be NULL");
+        }
+        lhs_c::CallbackUniform oRandom(rng);
+        if (n == 1)
+        {
+            lhs_c::degenerateCase(k, oRandom, design);
+            return;
+        }
+        bclib::matrix<double> result = bclib::matrix<double>(n, k);
+        lhslib::geneticLHS(n, k, pop, gen, pmut, criterium, verbose != 0, result, oRandom,
+            lhs_c::currentStatistics());
+        lhs_c::copyByColumn(result, design);
+    });
+}
+
+lhs_status lhs_create_oa(lhs_oa_type type, int q, int k, int param, int * oa,
+    size_t capacity, int * rows)
+{
+    return lhs_c::guard([=]() {
+        if (oa == NULL || rows == NULL)
+        {
+            throw lhs_c::argument_error("oa and rows may not be NULL");
+        }
+        oacpp::COrthogonalArray coa;
+        coa.setStatistics(lhs_c::currentStatistics());
+        int n = 0;
+        try
+        {
+            lhs_c::constructOA(coa, type, q, k, param, &n);
+        }
+        catch (std::runtime_error & e)
+        {
+            // the constructions only fail when q, k, or param are outside the range of the construction
+            throw lhs_c::argument_error(e.what());
+        }
+        const bclib::matrix<int> & result = coa.getoa();
+        *rows = static_cast<int>(result.rowsize());
+        if (capacity < result.rowsize() * result.colsize())
+        {
+            throw lhs_c::buffer_error("the orthogonal array buffer is too small");
+        }
+        lhs_c::copyByColumn(result, oa);
+    });
+}
+
+lhs_status lhs_check_oa_strength_sampled(int n, int k, int q, const int * oa, int t, int samples,
+    double confidence, const lhs_rng * rng, int * passed, double * violation_bound)
+{
+    return lhs_c::guard([=]() {
+        if (oa == NULL || passed == NULL || violation_bound == NULL)
+        {
+            throw lhs_c::argument_error("oa, passed, and violation_bound may not be NULL");
+        }
+        if (n < 1 || k < 1)
+        {
+            throw lhs_c::argument_error("n and k must be integers > 0");
+        }
+        if (q < 2)
+        {
+            throw lhs_c::argument_error("q must be an integer > 1");
+        }
+        if (t < 1 || t > k)
+        {
+            throw lhs_c::argument_error("t must be an integer on [1,k]");
+        }
+        if (samples < 0)
+        {
+            throw lhs_c::argument_error("samples must be an integer >= 0");
+        }
+        if (!(confidence > 0.0 && confidence < 1.0))
+        {
+            throw lhs_c::argument_error("confidence must be a double on the interval (0,1)");
+        }
+        lhs_c::CallbackUniform oCallback(rng);
+        bclib::matrix<int> oaMat = bclib::matrix<int>(n, k);
+        for (int j = 0; j < k; j++)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                int value = oa[i + j * n];
+                if (value < 0 || value >= q)
+                {
+                    throw lhs_c::argument_error("the values of oa must be integers on [0,q-1]");
+                }
+                oaMat(i, j) = value;
+            }
+        }
+        bclib::RunStatistics * stats = lhs_c::currentStatistics();
+        bclib::PhaseTimer timer(stats, "check");
+        int u_samples = (samples == 0) ? SAMPLEDSTR_DEFAULT_TUPLES : samples;
+        int result;
+        if (stats != NULL)
+        {
+            bclib::CountingRandom oRandom(oCallback);
+            result = oacpp::oastrength::OA_strt_sampled(q, oaMat, t, u_samples, confidence,
+                oRandom, violation_bound, 0);
+            stats->randomDraws += oRandom.draws();
+        }
+        else
+        {
+            result = oacpp::oastrength::OA_strt_sampled(q, oaMat, t, u_samples, confidence,
+                oCallback, violation_bound, 0);
+        }
+        *passed = (result == SUCCESS_CHECK) ? 1 : 0;
+    });
+}
+
+lhs_status lhs_oa_to_lhs(int n, int k, const int * oa, int verbose, const lhs_rng * rng,
+    double * design)
+{
+    return lhs_c::guard([=]() {
+        lhs_c::checkDesign(n, k, design);
+        if (oa == NULL)
+        {
+            throw lhs_c::argument_error("oa may not be NULL");
+        }
+        lhs_c::CallbackUniform oRandom(rng);
+        bclib::matrix<int> oaMat = bclib::matrix<int>(n, k);
+        for (int j = 0; j < k; j++)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                oaMat(i, j) = oa[i + j * n];
+            }
+        }
+        bclib::matrix<int> intlhs = bclib::matrix<int>(n, k);
+        bclib::matrix<double> lhs = bclib::matrix<double>(n, k);
+        oalhslib::oaLHS(n, k, oaMat, intlhs, lhs, verbose != 0, oRandom, lhs_c::currentStatistics());
+        lhs_c::copyByColumn(lhs, design);
+    });
+}
+
+lhs_status lhs_oalhs_size(int n, int k, int choose_larger_design, int * rows, int * cols)
+{
+    return lhs_c::guard([=]() {
+        if (rows == NULL || cols == NULL)
+        {
+            throw lhs_c::argument_error("rows and cols may not be NULL");
+        }
+        if (n < 1 || k < 1)
+        {
+            throw lhs_c::argument_error("n and k must be integers > 0");
+        }
+        oalhslib::OADesignPlan plan = oalhslib::planOADesign(n, k, choose_larger_design != 0, false);
+        *rows = static_cast<int>(plan.nrow);
+        *cols = plan.ncol;
+    });
+}
+
+lhs_status lhs_create_oalhs(int n, int k, int choose_larger_design, int verbose,
+    const lhs_rng * rng, double * design, size_t capacity)
+{
+    return lhs_c::guard([=]() {
+        if (design == NULL)
+        {
+            throw lhs_c::argument_error("the design buffer may not be NULL");
+        }
+        if (n < 1 || k < 1)
+        {
+            throw lhs_c::argument_error("n and k must be integers > 0");
+        }
+        lhs_c::CallbackUniform oRandom(rng);
+        /* the size is known from the plan, so the buffer is checked before any random numbers are drawn */
+        oalhslib::OADesignPlan plan = oalhslib::planOADesign(n, k, choose_larger_design != 0, false);
+        if (plan.nrow < 0 || plan.ncol < 0 ||
+            capacity < static_cast<size_t>(plan.nrow) * static_cast<size_t>(plan.ncol))
+        {
+            throw lhs_c::buffer_error("the design buffer is too small, see lhs_oalhs_size");
+        }
+        bclib::matrix<double> oalhs;
+        oalhslib::generateOALHS(n, k, oalhs, choose_larger_design != 0, verbose != 0, oRandom,
+            lhs_c::currentStatistics());
+        if (capacity < oalhs.rowsize() * oalhs.colsize())
+        {
+            throw std::runtime_error("the orthogonal array Latin hypercube does not match its plan"); // LCOV_EXCL_LINE
+        }
+        lhs_c::copyByColumn(oalhs, design);
+    });
+}
+
+lhs_statistics * lhs_statistics_create(void)
+{
+    return new (std::nothrow) lhs_statistics();
+}
+
+void lhs_statistics_free(lhs_statistics * stats)
+{
+    if (stats != NULL && lhs_c::threadStatistics() == stats)
+    {
+        lhs_c::threadStatistics() = NULL;
+    }
+    delete stats;
+}
+
+lhs_statistics * lhs_set_statistics(lhs_statistics * stats)
+{
+    lhs_statistics * previous = lhs_c::threadStatistics();
+    lhs_c::threadStatistics() = stats;
+    return previous;
+}
+
+double lhs_statistics_count(const lhs_statistics * stats, lhs_statistic which)
+{
+    if (stats == NULL)
+    {
+        return -1.0;
+    }
+    switch (which)
+    {
+    case LHS_STAT_CRITERION_EVALUATIONS:
+        return static_cast<double>(stats->stats.criterionEvaluations);
+    case LHS_STAT_CANDIDATES_SCORED:
+        return static_cast<double>(stats->stats.candidatesScored);
+    case LHS_STAT_ACCEPTED_MOVES:
+        return static_cast<double>(stats->stats.acceptedMoves);
+    case LHS_STAT_RANDOM_DRAWS:
+        return static_cast<double>(stats->stats.randomDraws);
+    case LHS_STAT_BYTES_ALLOCATED:
+        return static_cast<double>(stats->stats.bytesAllocated);
+    default:
+        return -1.0;
+    }
+}
+
+size_t lhs_statistics_trajectory(const lhs_statistics * stats, double * values, size_t capacity)
+{
+    if (stats == NULL)
+    {
+        return 0;
+    }
+    const std::vector<double> & trajectory = stats->stats.criterionTrajectory;
+    if (values != NULL)
+    {
+        std::copy(trajectory.begin(), trajectory.begin() + std::min(capacity, trajectory.size()), values);
+    }
+    return trajectory.size();
+}
+
+size_t lhs_statistics_phases(const lhs_statistics * stats)
+{
+    return (stats == NULL) ? 0 : stats->stats.phaseSeconds.size();
+}
+
+const char * lhs_statistics_phase_name(const lhs_statistics * stats, size_t phase)
+{
+    if (stats == NULL || phase >= stats->stats.phaseSeconds.size())
+    {
+        return NULL;
+    }
+    return stats->stats.phaseSeconds[phase].first.c_str();
+}
+
+double lhs_statistics_phase_seconds(const lhs_statistics * stats, size_t phase)
+{
+    if (stats == NULL || phase >= stats->stats.phaseSeconds.size())
+    {
+        return -1.0;
+    }
+    return stats->stats.phaseSeconds[phase].second;
+}
+
+} // extern "C"
@@ -0,0 +1,384 @@
+/**
+ * @file lhs_c.h
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LHS_C_H
+#define	LHS_C_H
+
+#include <stddef.h>
+
+/*
+ * A C interface to the Latin hypercube and orthogonal array engines that does
+ * not need R.
+ *
+ * Conventions:
+ *   - every design is n x k and stored by column, the layout of R, Fortran,
+ *     and BLAS: element (i, j) is design[i + j*n]
+ *   - the caller allocates every output buffer
+ *   - random numbers come from a caller supplied callback, so the caller
+ *     controls the generator, the seed, and the thread safety
+ *   - every function returns an lhs_status.  No C++ exception escapes.  The
+ *     message of the last failure on the calling thread is available from
+ *     lhs_last_error
+ *   - the designs are the same as the R package for the same stream of
+ *     uniform random numbers
+ *   - verbose messages go to standard output, or to the R console when the
+ *     library is compiled in the R package
+ *   - the statistics of the optimizers are collected in an
+ *     <code>lhs_statistics</code> attached to the calling thread with
+ *     lhs_set_statistics
+ *   - large designs are computed on several threads, at most
+ *     lhs_get_max_threads.  The limit is set with lhs_set_max_threads or the
+ *     <code>LHS_NUM_THREADS</code> environment variable
+ */
+
+/** The version of the C interface, incremented when a function is added or a signature changes */
+#define LHS_C_API_VERSION 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The result of a call
+ */
+typedef enum lhs_status
+{
+    LHS_OK = 0, /**< success */
+    LHS_ERROR_ARGUMENT = 1, /**< a null pointer or an invalid argument */
+    LHS_ERROR_BUFFER = 2, /**< the output buffer is too small */
+    LHS_ERROR_RUNTIME = 3, /**< the algorithm failed */
+    LHS_ERROR_MEMORY = 4 /**< memory could not be allocated */
+} lhs_status;
+
+/**
+ * A function that returns the next standard uniform deviate on (0,1)
+ * @param state the generator state given in <code>lhs_rng</code>
+ */
+typedef double (*lhs_uniform_callback)(void * state);
+
+/**
+ * A random number generator supplied by the caller
+ */
+typedef struct lhs_rng
+{
+    lhs_uniform_callback uniform; /**< draws the next deviate */
+    void * state; /**< passed to every call of <code>uniform</code> */
+} lhs_rng;
+
+/**
+ * The orthogonal array constructions
+ */
+typedef enum lhs_oa_type
+{
+    LHS_OA_ADDELKEMP = 0, /**< OA(2q^2, k, q, 2), k <= 2q+1, odd prime power q */
+    LHS_OA_ADDELKEMP3 = 1, /**< OA(2q^3, k, q, 2), k <= 2q^2+2q+1, prime power q */
+    LHS_OA_ADDELKEMPN = 2, /**< OA(2q^param, k, q, 2), k <= 2(q^param-1)/(q-1)-1, prime power q */
+    LHS_OA_BOSE = 3, /**< OA(q^2, k, q, 2), k <= q+1, prime power q */
+    LHS_OA_BOSEBUSH = 4, /**< OA(2q^2, k, q, 2), k <= 2q+1, q a power of 2 */
+    LHS_OA_BOSEBUSHL = 5, /**< OA(param*q^2, k, q, 2), k <= param*q+1, param and q powers of the same prime */
+    LHS_OA_BUSH = 6, /**< OA(q^3, k, q, 3), k <= q+1, prime power q */
+    LHS_OA_BUSHT = 7 /**< OA(q^param, k, q, param), k <= q+1, param >= 3, prime power q */
+} lhs_oa_type;
+
+/**
+ * The statistics of the calls made on a thread, an opaque handle
+ */
+typedef struct lhs_statistics lhs_statistics;
+
+/**
+ * The counts of an <code>lhs_statistics</code>
+ */
+typedef enum lhs_statistic
+{
+    LHS_STAT_CRITERION_EVALUATIONS = 0, /**< evaluations of the optimality criterion */
+    LHS_STAT_CANDIDATES_SCORED = 1, /**< candidate points, swaps, or designs scored */
+    LHS_STAT_ACCEPTED_MOVES = 2, /**< candidates accepted into the design */
+    LHS_STAT_RANDOM_DRAWS = 3, /**< uniform random numbers drawn */
+    LHS_STAT_BYTES_ALLOCATED = 4 /**< bytes of working storage allocated */
+} lhs_statistic;
+
+/**
+ * The version of the C interface
+ * @return <code>LHS_C_API_VERSION</code> of the library
+ */
+int lhs_api_version(void);
+
+/**
+ * The version of the Latin hypercube library
+ * @return the version string
+ */
+const char * lhs_version(void);
+
+/**
+ * The message of the last failed call on this thread
+ * @return the message, empty if no call has failed
+ */
+const char * lhs_last_error(void);
+
+/**
+ * Limit the number of threads used for large designs in every thread of the process
+ * @param nthreads the maximum number of threads, or 0 to restore the default:
+ * the <code>LHS_NUM_THREADS</code> environment variable if it is set, otherwise
+ * the number of processors
+ * @return the status
+ */
+lhs_status lhs_set_max_threads(int nthreads);
+
+/**
+ * The maximum number of threads used for large designs
+ * @return the number of threads, at least 1
+ */
+int lhs_get_max_threads(void);
+
+/**
+ * A random Latin hypercube sample
+ * @param n the number of rows
+ * @param k the number of columns
+ * @param preserve_draw nonzero to draw the same columns regardless of <code>k</code>
+ * @param rng the random number generator
+ * @param design the n x k sample on return
+ * @return the status
+ */
+lhs_status lhs_random(int n, int k, int preserve_draw, const lhs_rng * rng, double * design);
+
+/**
+ * An improved distributed Latin hypercube sample
+ * @param n the number of rows
+ * @param k the number of columns
+ * @param dup the number of candidate points for each point in the sample
+ * @param rng the random number generator
+ * @param design the n x k sample on return
+ * @return the status
+ */
+lhs_status lhs_improved(int n, int k, int dup, const lhs_rng * rng, double * design);
+
+/**
+ * A maximin Latin hypercube sample
+ * @param n the number of rows
+ * @param k the number of columns
+ * @param dup the number of candidate points for each point in the sample
+ * @param rng the random number generator
+ * @param design the n x k sample on return
+ * @return the status
+ */
+lhs_status lhs_maximin(int n, int k, int dup, const lhs_rng * rng, double * design);
+
+/**
+ * An optimum Latin hypercube sample
+ * @param n the number of rows
+ * @param k the number of columns
+ * @param max_sweeps the maximum number of sweeps of the optimization
+ * @param eps the optimal stopping criterion on (0,1)
+ * @param verbose nonzero to print messages
+ * @param rng the random number generator
+ * @param design the n x k sample on return
+ * @return the status
+ */
+lhs_status lhs_optimum(int n, int k, int max_sweeps, double eps, int verbose,
+    const lhs_rng * rng, double * design);
+
+/**
+ * Optimize a Latin hypercube sample in place
+ * @param n the number of rows
+ * @param k the number of columns
+ * @param max_sweeps the maximum number of sweeps of the optimization
+ * @param eps the optimal stopping criterion on (0,1)
+ * @param verbose nonzero to print messages
+ * @param design the n x k seed sample, replaced by the optimized sample
+ * @return the status
+ */
+lhs_status lhs_optimum_seeded(int n, int k, int max_sweeps, double eps, int verbose,
+    double * design);
+
+/**
+ * A Latin hypercube sample from a genetic algorithm
+ * @param n the number of rows
+ * @param k the number of columns
+ * @param pop the number of designs in each generation
+ * @param gen the number of generations
+ * @param pmut the probability of a mutation
+ * @param criterium the optimality criterium, <code>S</code> or <code>Maximin</code>
+ * @param verbose nonzero to print messages
+ * @param rng the random number generator
+ * @param design the n x k sample on return
+ * @return the status
+ */
+lhs_status lhs_genetic(int n, int k, int pop, int gen, double pmut, const char * criterium,
+    int verbose, const lhs_rng * rng, double * design);
+
+/**
+ * Construct an orthogonal array
+ *
+ * When <code>capacity</code> is too small, <code>rows</code> is set and
+ * <code>LHS_ERROR_BUFFER</code> is returned so the call can be repeated with
+ * a larger buffer.  A q, k, or param outside the range of the construction is
+ * an <code>LHS_ERROR_ARGUMENT</code>.
+ *
+ * @param type the construction
+ * @param q the number of symbols in each column <code>(0,...,q-1)</code>
+ * @param k the number of columns
+ * @param param lambda for bosebushl, the exponent for addelkempn, the strength for busht, otherwise ignored
+ * @param oa the rows x k array on return
+ * @param capacity the number of elements in <code>oa</code>
+ * @param rows the number of rows of the array on return
+ * @return the status
+ */
+lhs_status lhs_create_oa(lhs_oa_type type, int q, int k, int param, int * oa,
+    size_t capacity, int * rows);
+
+/**
+ * Check the strength of an orthogonal array on a random sample of column tuples
+ *
+ * When every t-tuple of columns fits in the sample, every tuple is checked
+ * and <code>violation_bound</code> is 0.  Otherwise <code>samples</code>
+ * tuples are drawn uniformly and, when none violates strength t, the fraction
+ * of violating tuples is below <code>1-(1-confidence)^(1/samples)</code> with
+ * the given confidence.  A violation sets <code>violation_bound</code> to 1.
+ *
+ * @param n the number of rows
+ * @param k the number of columns
+ * @param q the number of symbols in each column <code>(0,...,q-1)</code>
+ * @param oa the n x k orthogonal array
+ * @param t the strength to check on <code>[1,k]</code>
+ * @param samples the number of column tuples to sample, or 0 for the default of 1000
+ * @param confidence the confidence level of the bound on (0,1)
+ * @param rng the random number generator used to sample the column tuples
+ * @param passed 1 on return if no checked tuple violates strength t, otherwise 0
+ * @param violation_bound the upper bound on the fraction of violating column tuples on return
+ * @return the status
+ */
+lhs_status lhs_check_oa_strength_sampled(int n, int k, int q, const int * oa, int t, int samples,
+    double confidence, const lhs_rng * rng, int * passed, double * violation_bound);
+
+/**
+ * A Latin hypercube sample from an orthogonal array
+ * @param n the number of rows
+ * @param k the number of columns
+ * @param oa the n x k orthogonal array
+ * @param verbose nonzero to print messages
+ * @param rng the random number generator
+ * @param design the n x k sample on return
+ * @return the status
+ */
+lhs_status lhs_oa_to_lhs(int n, int k, const int * oa, int verbose, const lhs_rng * rng,
+    double * design);
+
+/**
+ * The size of the orthogonal array Latin hypercube that <code>lhs_create_oalhs</code> produces
+ * @param n the requested number of rows
+ * @param k the requested number of columns
+ * @param choose_larger_design nonzero to choose a larger design when none has exactly n rows
+ * @param rows the number of rows on return
+ * @param cols the number of columns on return
+ * @return the status
+ */
+lhs_status lhs_oalhs_size(int n, int k, int choose_larger_design, int * rows, int * cols);
+
+/**
+ * An orthogonal array Latin hypercube sample
+ *
+ * The design has the size given by <code>lhs_oalhs_size</code>, which is
+ * checked against <code>capacity</code> before any random numbers are drawn.
+ *
+ * @param n the requested number of rows
+ * @param k the requested number of columns
+ * @param choose_larger_design nonzero to choose a larger design when none has exactly n rows
+ * @param verbose nonzero to print messages
+ * @param rng the random number generator
+ * @param design the sample on return
+ * @param capacity the number of elements in <code>design</code>
+ * @return the status
+ */
+lhs_status lhs_create_oalhs(int n, int k, int choose_larger_design, int verbose,
+    const lhs_rng * rng, double * design, size_t capacity);
+
+/**
+ * Create an empty statistics collector
+ * @return the collector, or NULL if memory could not be allocated
+ */
+lhs_statistics * lhs_statistics_create(void);
+
+/**
+ * Release a statistics collector
+ *
+ * A collector attached to the calling thread is detached first.  It must not
+ * be attached to any other thread.
+ *
+ * @param stats the collector, NULL is ignored
+ */
+void lhs_statistics_free(lhs_statistics * stats);
+
+/**
+ * Attach a statistics collector to the calling thread
+ *
+ * The following calls on the thread add their statistics to the collector.
+ * <code>lhs_random</code> does not collect statistics.
+ *
+ * @param stats the collector, or NULL to stop collecting
+ * @return the collector attached before, or NULL
+ */
+lhs_statistics * lhs_set_statistics(lhs_statistics * stats);
+
+/**
+ * A count of a statistics collector
+ * @param stats the collector
+ * @param which the count
+ * @return the count, or -1 if <code>stats</code> is NULL or <code>which</code> is unknown
+ */
+double lhs_statistics_count(const lhs_statistics * stats, lhs_statistic which);
+
+/**
+ * The trajectory of the optimality criterion, one value after each step of
+ * the optimizers in the order the steps ran
+ * @param stats the collector
+ * @param values the first <code>capacity</code> values on return, may be NULL if <code>capacity</code> is 0
+ * @param capacity the number of elements in <code>values</code>
+ * @return the length of the trajectory
+ */
+size_t lhs_statistics_trajectory(const lhs_statistics * stats, double * values, size_t capacity);
+
+/**
+ * The number of timed phases
+ * @param stats the collector
+ * @return the number of phases, 0 if <code>stats</code> is NULL
+ */
+size_t lhs_statistics_phases(const lhs_statistics * stats);
+
+/**
+ * The name of a timed phase
+ * @param stats the collector
+ * @param phase the phase on <code>[0, lhs_statistics_phases)</code>
+ * @return the name, NULL if the phase does not exist
+ */
+const char * lhs_statistics_phase_name(const lhs_statistics * stats, size_t phase);
+
+/**
+ * The wall time of a phase summed over the calls
+ * @param stats the collector
+ * @param phase the phase on <code>[0, lhs_statistics_phases)</code>
+ * @return the seconds, -1 if the phase does not exist
+ */
+double lhs_statistics_phase_seconds(const lhs_statistics * stats, size_t phase);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* LHS_C_H */
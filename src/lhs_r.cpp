@@ -41,6 +41,12 @@
  */
 #include "lhs_r.h"
 
+/*
+ * The functions below check and convert the R arguments and call the C
+ * interface in lhs_c.h with R's random number generator, so the R package
+ * and other callers of the C interface produce the same designs.
+ */
+
 RcppExport SEXP /*double matrix*/ improvedLHS_cpp(SEXP /*int*/ n, SEXP /*int*/ k,
         SEXP /*int*/ dup)
 {
@@ -55,28 +61,17 @@ RcppExport SEXP /*double matrix*/ improvedLHS_cpp(SEXP /*int*/ n, SEXP /*int*/ k
     int m_k = Rcpp::as<int>(k);
     int m_dup = Rcpp::as<int>(dup);
     lhs_r::checkArguments(m_n, m_k, m_dup);
-    bclib::matrix<int> intMat = bclib::matrix<int>(m_n, m_k);
-    Rcpp::NumericMatrix result;
+    Rcpp::NumericMatrix result(Rcpp::no_init(m_n, m_k));
+    lhs_status status;
+    lhs_r::StatisticsScope statistics;
 
     START_RNG
       lhs_r::RStandardUniform oRStandardUniform = lhs_r::RStandardUniform();
-      if (m_n == 1)
-      { 
-        result = lhs_r::degenerateCase(m_k, oRStandardUniform); 
-      } 
-      else
-      {
-        try
-        {
-            lhslib::improvedLHS(m_n, m_k, m_dup, intMat, oRStandardUniform);
-        } catch (...)
-        {
-            END_RNG
-            throw;
-        }
-        result = lhs_r::convertIntegerToNumericLhs(intMat);
-      }
+      lhs_rng rng = {lhs_r::RStandardUniform::uniform, &oRStandardUniform};
+      status = lhs_improved(m_n, m_k, m_dup, &rng, result.begin());
     END_RNG
+    lhs_r::checkStatus(status);
+    statistics.setAttribute(result);
 
     return result;
   END_RCPP
@@ -96,28 +91,17 @@ RcppExport SEXP /*double matrix*/ maximinLHS_cpp(SEXP /*int*/ n, SEXP /*int*/ k,
     int m_k = Rcpp::as<int>(k);
     int m_dup = Rcpp::as<int>(dup);
     lhs_r::checkArguments(m_n, m_k, m_dup);
-    bclib::matrix<int> intMat = bclib::matrix<int>(m_n, m_k);
-    Rcpp::NumericMatrix result;
+    Rcpp::NumericMatrix result(Rcpp::no_init(m_n, m_k));
+    lhs_status status;
+    lhs_r::StatisticsScope statistics;
 
     START_RNG
       lhs_r::RStandardUniform oRStandardUniform = lhs_r::RStandardUniform();
-      if (m_n == 1)
-      {
-        result = lhs_r::degenerateCase(m_k, oRStandardUniform);
-      }
-      else
-      {
-        try
-        {
-            lhslib::maximinLHS(m_n, m_k, m_dup, intMat, oRStandardUniform);
-        } catch (...)
-        {
-            END_RNG
-            throw;
-        }
-        result = lhs_r::convertIntegerToNumericLhs(intMat);
-      }
+      lhs_rng rng = {lhs_r::RStandardUniform::uniform, &oRStandardUniform};
+      status = lhs_maximin(m_n, m_k, m_dup, &rng, result.begin());
     END_RNG
+    lhs_r::checkStatus(status);
+    statistics.setAttribute(result);
 
     return result;
   END_RCPP
@@ -139,30 +123,17 @@ RcppExport SEXP /*double matrix*/ optimumLHS_cpp(SEXP /*int*/ n, SEXP /*int*/ k,
     double m_eps = Rcpp::as<double>(eps);
     bool m_bVerbose = Rcpp::as<bool>(bVerbose);
     lhs_r::checkArguments(m_n, m_k, m_maxsweeps, m_eps);
-    bclib::matrix<int> intMat = bclib::matrix<int>(m_n, m_k);
-    int jLen = static_cast<int>(::Rf_choose(static_cast<double>(m_n), 2.0) + 1.0);
-    Rcpp::NumericMatrix result;
-    
+    Rcpp::NumericMatrix result(Rcpp::no_init(m_n, m_k));
+    lhs_status status;
+    lhs_r::StatisticsScope statistics;
+
     START_RNG
       lhs_r::RStandardUniform oRStandardUniform = lhs_r::RStandardUniform();
-      if (m_n == 1)
-      {
-          result = lhs_r::degenerateCase(m_k, oRStandardUniform);
-      }
-      else
-      {
-        try
-        {
-            lhslib::optimumLHS(m_n, m_k, m_maxsweeps, m_eps, intMat,
-                               jLen, oRStandardUniform, m_bVerbose);
-        } catch (...)
-        {
-            END_RNG
-            throw;
-        }
-        result = lhs_r::convertIntegerToNumericLhs(intMat);
-	  }
+      lhs_rng rng = {lhs_r::RStandardUniform::uniform, &oRStandardUniform};
+      status = lhs_optimum(m_n, m_k, m_maxsweeps, m_eps, m_bVerbose, &rng, result.begin());
     END_RNG
+    lhs_r::checkStatus(status);
+    statistics.setAttribute(result);
 
     return result;
   END_RCPP
@@ -196,20 +167,13 @@ RcppExport SEXP /*double matrix*/ optSeededLHS_cpp(SEXP /*int*/ n, SEXP /*int*/
         return m_inlhs;
     }
 
-    int jLen = static_cast<int>(::Rf_choose(static_cast<double>(m_n), 2.0) + 1.0);
-    bclib::matrix<double> mm_inlhs = bclib::matrix<double>(m_n, m_k);
-    for (int i = 0; i < m_n; i++)
-    {
-        for (int j = 0; j < m_k; j++)
-        {
-            mm_inlhs(i,j) = m_inlhs(i,j);
-        }
-    }
-
-    lhslib::optSeededLHS(m_n, m_k, m_maxsweeps, m_eps, mm_inlhs,
-            jLen, m_bVerbose);
-
-    Rcpp::NumericMatrix result = lhs_r::convertMatrixToNumericLhs(mm_inlhs);
+    // the seed is copied so the input is unchanged and its attributes are not returned
+    Rcpp::NumericMatrix result(Rcpp::no_init(m_n, m_k));
+    std::copy(m_inlhs.begin(), m_inlhs.end(), result.begin());
+    lhs_r::StatisticsScope statistics;
+    lhs_r::checkStatus(lhs_optimum_seeded(m_n, m_k, m_maxsweeps, m_eps, m_bVerbose,
+        result.begin()));
+    statistics.setAttribute(result);
 
     return result;
   END_RCPP
@@ -228,35 +192,15 @@ RcppExport SEXP randomLHS_cpp(SEXP n, SEXP k, SEXP preserveDraw)
     int m_k = Rcpp::as<int>(k);
     bool bPreserveDraw = Rcpp::as<bool>(preserveDraw);
     lhs_r::checkArguments(m_n, m_k);
-    bclib::matrix<double> result = bclib::matrix<double>(m_n, m_k);
-    Rcpp::NumericMatrix rresult;
+    Rcpp::NumericMatrix rresult(Rcpp::no_init(m_n, m_k));
+    lhs_status status;
 
     START_RNG
       lhs_r::RStandardUniform oRStandardUniform = lhs_r::RStandardUniform();
-      if (m_n == 1)
-      {
-        rresult = lhs_r::degenerateCase(m_k, oRStandardUniform);
-      }
-      else
-      {
-        try
-        {
-            lhslib::randomLHS(m_n, m_k, bPreserveDraw, result, oRStandardUniform);
-        } catch (...)
-        {
-            END_RNG
-            throw;
-        }
-        rresult = Rcpp::NumericMatrix(m_n, m_k);
-        for (int irow = 0; irow < m_n; irow++)
-        {
-          for (int jcol = 0; jcol < m_k; jcol++)
-          {
-            rresult(irow, jcol) = result(irow, jcol);
-          }
-        }
-      }
+      lhs_rng rng = {lhs_r::RStandardUniform::uniform, &oRStandardUniform};
+      status = lhs_random(m_n, m_k, bPreserveDraw, &rng, rresult.begin());
     END_RNG
+    lhs_r::checkStatus(status);
 
     return rresult;
   END_RCPP
@@ -275,36 +219,18 @@ RcppExport SEXP geneticLHS_cpp(SEXP /*int*/ n, SEXP /*int*/ k, SEXP /*int*/ pop,
     std::string m_criterium = Rcpp::as<std::string>(criterium);
     bool m_bVerbose = Rcpp::as<bool>(bVerbose);
     lhs_r::checkArguments(m_n, m_k);
-    bclib::matrix<double> mat = bclib::matrix<double>(m_n, m_k);
-    Rcpp::NumericMatrix rresult;
+    Rcpp::NumericMatrix rresult(Rcpp::no_init(m_n, m_k));
+    lhs_status status;
+    lhs_r::StatisticsScope statistics;
 
     START_RNG
       lhs_r::RStandardUniform oRStandardUniform = lhs_r::RStandardUniform();
-      if (m_n == 1)
-      {
-        rresult = lhs_r::degenerateCase(m_k, oRStandardUniform);
-      }
-      else 
-      {
-        try
-        {
-            lhslib::geneticLHS(m_n, m_k, m_pop, m_gen, m_pMut, m_criterium, m_bVerbose,
-                               mat, oRStandardUniform);
-        } catch (...)
-        {
-            END_RNG
-            throw;
-        }
-        rresult = Rcpp::NumericMatrix(m_n, m_k);
-        for (int irow = 0; irow < m_n; irow++)
-        {
-          for (int jcol = 0; jcol < m_k; jcol++)
-          {
-            rresult(irow, jcol) = mat(irow, jcol);
-          }
-        }
-      }
+      lhs_rng rng = {lhs_r::RStandardUniform::uniform, &oRStandardUniform};
+      status = lhs_genetic(m_n, m_k, m_pop, m_gen, m_pMut, m_criterium.c_str(),
+                           m_bVerbose, &rng, rresult.begin());
     END_RNG
+    lhs_r::checkStatus(status);
+    statistics.setAttribute(rresult);
 
     return rresult;
   END_RCPP
@@ -31,63 +31,18 @@ namespace lhs_r
         // TODO: could we have done orderlocal = Rcpp::as<std::vector<int> >(order); ??
     }
 
-    Rcpp::NumericMatrix convertIntegerToNumericLhs(const bclib::matrix<int> & intMat)
-    {
-        bclib::matrix<int>::size_type rows;
-        bclib::matrix<int>::size_type cols;
-        rows = intMat.rowsize();
-        cols = intMat.colsize();
-        Rcpp::NumericMatrix result(rows, cols);
-        Rcpp::NumericVector eps = Rcpp::runif(static_cast<int>(rows*cols));
-        unsigned int counter = 0;
-        // I think this is right (iterate over rows within columns
-        for (bclib::matrix<int>::size_type col = 0; col < cols; col++)
-        {
-            for (bclib::matrix<int>::size_type row = 0; row < rows; row++)
-            {
-                result(row, col) = static_cast<double>(intMat(row, col) - 1) + eps[counter];
-                result(row, col) /= static_cast<double>(rows);
-                counter++;
-            }
-        }
-
-        return result;
-    }
-
     Rcpp::NumericMatrix convertIntegerToNumericLhs(const Rcpp::IntegerMatrix & intMat)
     {
         int n = intMat.rows();
         int k = intMat.cols();
-        Rcpp::NumericMatrix result(n, k);
-        Rcpp::NumericVector eps = Rcpp::runif(static_cast<int>(n*k));
-        unsigned int counter = 0;
-        // I think this is right (iterate over rows within columns
+        Rcpp::NumericMatrix result(Rcpp::no_init(n, k));
+        // the uniform deviates are drawn in column order straight into the result
         for (bclib::matrix<int>::size_type col = 0; col < static_cast<unsigned int>(k); col++)
         {
             for (bclib::matrix<int>::size_type row = 0; row < static_cast<unsigned int>(n); row++)
             {
-                result(row, col) = static_cast<double>(intMat(row, col) - 1) + eps[counter];
-                result(row, col) /= static_cast<double>(n);
-                counter++;
-            }
-        }
-
-        return result;
-    }
-
-    Rcpp::NumericMatrix convertMatrixToNumericLhs(const bclib::matrix<double> & intMat)
-    {
-        //std::vector<double>::iterator i = intMat.getDataVector().begin();  this iterator is row wise, but numeric matrix may be columnwise
-        bclib::matrix<int>::size_type rows = intMat.rowsize();
-        bclib::matrix<int>::size_type cols = intMat.colsize();
-        //Rcpp::NumericMatrix result(rows, cols, i);
-
-        Rcpp::NumericMatrix result(rows, cols);
-        for (bclib::matrix<int>::size_type i = 0; i < rows; i++)
-        {
-            for (bclib::matrix<int>::size_type j = 0; j < cols; j++)
-            {
-                result(i, j) = intMat(i, j);
+                result(row, col) = (static_cast<double>(intMat(row, col) - 1) + R::runif(0.0, 1.0)) /
+                    static_cast<double>(n);
             }
         }
 
@@ -166,13 +121,88 @@ namespace lhs_r
 		}
     }
 
-    Rcpp::NumericMatrix degenerateCase(int k, bclib::CRandom<double> & oRandom)
+    void checkStatus(lhs_status status)
+    {
+        if (status != LHS_OK)
+        {
+            throw std::runtime_error(lhs_last_error());
+        }
+    }
+
+    bool statisticsRequested()
     {
-        Rcpp::NumericMatrix Z(1, k);
-        for (int i = 0; i < k; i++)
+        SEXP option = Rf_GetOption1(Rf_install("lhs.statistics"));
+        return TYPEOF(option) == LGLSXP && Rf_length(option) == 1 && LOGICAL(option)[0] == TRUE;
+    }
+
+    void setStatisticsAttribute(Rcpp::RObject result, const bclib::RunStatistics & stats)
+    {
+        Rcpp::NumericVector phaseSeconds(stats.phaseSeconds.size());
+        Rcpp::CharacterVector phaseNames(stats.phaseSeconds.size());
+        for (size_t i = 0; i < stats.phaseSeconds.size(); i++)
+        {
+            phaseSeconds[i] = stats.phaseSeconds[i].second;
+            phaseNames[i] = stats.phaseSeconds[i].first;
+        }
+        phaseSeconds.attr("names") = phaseNames;
+        // the counts are doubles because R has no 64 bit integers
+        result.attr("statistics") = Rcpp::List::create(
+            Rcpp::Named("criterion_evaluations") = static_cast<double>(stats.criterionEvaluations),
+            Rcpp::Named("candidates_scored") = static_cast<double>(stats.candidatesScored),
+            Rcpp::Named("accepted_moves") = static_cast<double>(stats.acceptedMoves),
+            Rcpp::Named("random_draws") = static_cast<double>(stats.randomDraws),
+            Rcpp::Named("bytes_allocated") = static_cast<double>(stats.bytesAllocated),
+            Rcpp::Named("criterion_trajectory") = Rcpp::wrap(stats.criterionTrajectory),
+            Rcpp::Named("phase_seconds") = phaseSeconds);
+    }
+
+    StatisticsScope::StatisticsScope()
+        : m_stats(NULL), m_previous(NULL)
+    {
+        if (statisticsRequested())
+        {
+            m_stats = lhs_statistics_create();
+            if (m_stats == NULL)
+            {
+                throw std::bad_alloc(); // LCOV_EXCL_LINE
+            }
+            m_previous = lhs_set_statistics(m_stats);
+        }
+    }
+
+    StatisticsScope::~StatisticsScope()
+    {
+        if (m_stats != NULL)
+        {
+            lhs_set_statistics(m_previous);
+            lhs_statistics_free(m_stats);
+        }
+    }
+
+    void StatisticsScope::setAttribute(Rcpp::RObject result)
+    {
+        if (m_stats == NULL)
+        {
+            return;
+        }
+        // copy the collector of the C interface into the statistics of the library
+        bclib::RunStatistics stats;
+        stats.criterionEvaluations = static_cast<bclib::RunStatistics::count_type>(
+            lhs_statistics_count(m_stats, LHS_STAT_CRITERION_EVALUATIONS));
+        stats.candidatesScored = static_cast<bclib::RunStatistics::count_type>(
+            lhs_statistics_count(m_stats, LHS_STAT_CANDIDATES_SCORED));
+        stats.acceptedMoves = static_cast<bclib::RunStatistics::count_type>(
+            lhs_statistics_count(m_stats, LHS_STAT_ACCEPTED_MOVES));
+        stats.randomDraws = static_cast<bclib::RunStatistics::count_type>(
+            lhs_statistics_count(m_stats, LHS_STAT_RANDOM_DRAWS));
+        stats.bytesAllocated = static_cast<bclib::RunStatistics::count_type>(
+            lhs_statistics_count(m_stats, LHS_STAT_BYTES_ALLOCATED));
+        stats.criterionTrajectory.resize(lhs_statistics_trajectory(m_stats, NULL, 0));
+        lhs_statistics_trajectory(m_stats, stats.criterionTrajectory.data(), stats.criterionTrajectory.size());
+        for (size_t i = 0; i < lhs_statistics_phases(m_stats); i++)
         {
-          Z(0, i) = oRandom.getNextRandom();
+            stats.addPhaseSeconds(lhs_statistics_phase_name(m_stats, i), lhs_statistics_phase_seconds(m_stats, i));
         }
-        return Z;
+        setStatisticsAttribute(result, stats);
     }
 } // end namespace
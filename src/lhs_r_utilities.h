@@ -23,6 +23,7 @@
 
 #include <Rcpp.h>
 #include "LHSCommonDefines.h"
+#include "lhs_c.h"
 
 /**
  * @namespace lhs_r a namespace for the lhs methods used in the R interface
@@ -35,18 +36,6 @@ namespace lhs_r
      * @param order the order of the input values
      */
     void findorder_zero(const Rcpp::NumericVector & v, Rcpp::IntegerVector & order);
-    /**
-     * convert an integer matrix to a numeric latin hypercube sample
-     * @param intMat the input matrix to be converted
-     * @return a latin hypercube sample
-     */
-    Rcpp::NumericMatrix convertIntegerToNumericLhs(const bclib::matrix<int> & intMat);
-    /**
-     * convert a numeric matrix to a numeric latin hypercube sample
-     * @param intMat the input matrix to be converted
-     * @return a Latin hypercube sample
-     */
-    Rcpp::NumericMatrix convertMatrixToNumericLhs(const bclib::matrix<double> & intMat);
     /**
      * convert a Rcpp::IntegerMatrix to a numeric latin hypercube sample
      * @param intMat the input matrix to be converted
@@ -83,12 +72,52 @@ namespace lhs_r
      */
     void checkArguments(int n, int k, int maxsweeps, double eps);
     /**
-     * develop an lhs sample in the degenerate case
-     * @param k number parameters / columns in the lhs
-     * @param oRandom a random number generator for the hypercube
-     * @return the numeric matrix for the degenerate case
+     * check the status returned by the C interface
+     * @param status the status
+     * @throws std::runtime_error with the message of the C interface if the call failed
      */
-    Rcpp::NumericMatrix degenerateCase(int k, bclib::CRandom<double> & oRandom);
+    void checkStatus(lhs_status status);
+
+    /**
+     * Are run statistics requested with the R option <code>lhs.statistics = TRUE</code>?
+     * @return true if the option is <code>TRUE</code>
+     */
+    bool statisticsRequested();
+    /**
+     * Set the <code>statistics</code> attribute of a result to a list of the run statistics
+     * @param result the result returned to R
+     * @param stats the statistics of the run
+     */
+    void setStatisticsAttribute(Rcpp::RObject result, const bclib::RunStatistics & stats);
+
+    /**
+     * Collect the statistics of the calls to the C interface made while it is
+     * in scope, when <code>statisticsRequested</code>
+     */
+    class StatisticsScope
+    {
+    public:
+        /**
+         * Constructor that attaches a collector to the thread if the option is set
+         */
+        StatisticsScope();
+        /**
+         * Destructor that detaches and releases the collector
+         */
+        ~StatisticsScope();
+        /**
+         * Set the <code>statistics</code> attribute of a result if statistics are collected
+         * @param result the result returned to R
+         */
+        void setAttribute(Rcpp::RObject result);
+
+    private:
+        lhs_statistics * m_stats; /**< the collector, NULL if the option is not set */
+        lhs_statistics * m_previous; /**< the collector attached before */
+
+        StatisticsScope(const StatisticsScope &);
+        StatisticsScope & operator=(const StatisticsScope &);
+    };
 
     /**
      * Calculate the distance between points in a matrix
@@ -26,6 +26,8 @@
 #include <string>
 #include <sstream>
 #include <cstddef>
+#include <utility>
+#include <type_traits>
 
 /**
  * @namespace bclib The bertcarnell template library namespace
@@ -35,6 +37,8 @@ namespace bclib {
 // forward declare the iterator
 template <class T, bool ISROWWISE> class matrixIter;
 template <class T, bool ISROWWISE> class matrixConstIter;
+template <class T, bool ROWMAJOR> class matrixView;
+template <class T> class vectorView;
     
 /**
  * Matrix Class
@@ -87,6 +91,17 @@ private:
       {
           return (!bTranspose) ? (row*cols + col) : (col*rows + row);
       }
+      /**
+       * Check that the storage has the requested layout
+       * @param bRowMajor true if contiguous rows are requested
+       */
+      void checkLayout(bool bRowMajor) const
+      {
+          if (bRowMajor == bTranspose)
+          {
+              throw std::logic_error("the matrix layout does not match the requested view");
+          }
+      }
    public:
        /// The number of rows in the matrix
        size_type rowsize() const {return rows;};
@@ -166,6 +181,53 @@ private:
       
       /// a pointer to the internal data array
       T* data() {return elements.data();};
+
+      /// a const pointer to the internal data array
+      const T* data() const {return elements.data();};
+
+      /**
+       * A view of the matrix with contiguous rows
+       * @throws std::logic_error if the matrix is transposed and the columns are contiguous
+       * @return the view
+       */
+      matrixView<T, true> rowMajorView()
+      {
+          checkLayout(true);
+          return matrixView<T, true>(elements.data(), rows, cols, cols);
+      }
+
+      /**
+       * A read-only view of the matrix with contiguous rows
+       * @throws std::logic_error if the matrix is transposed and the columns are contiguous
+       * @return the view
+       */
+      matrixView<const T, true> rowMajorView() const
+      {
+          checkLayout(true);
+          return matrixView<const T, true>(elements.data(), rows, cols, cols);
+      }
+
+      /**
+       * A view of the matrix with contiguous columns
+       * @throws std::logic_error if the matrix is not transposed and the rows are contiguous
+       * @return the view
+       */
+      matrixView<T, false> columnMajorView()
+      {
+          checkLayout(false);
+          return matrixView<T, false>(elements.data(), rows, cols, rows);
+      }
+
+      /**
+       * A read-only view of the matrix with contiguous columns
+       * @throws std::logic_error if the matrix is not transposed and the rows are contiguous
+       * @return the view
+       */
+      matrixView<const T, false> columnMajorView() const
+      {
+          checkLayout(false);
+          return matrixView<const T, false>(elements.data(), rows, cols, rows);
+      }
       
       /// get the internal data vector
       std::vector<T> getDataVector() const {return elements;};
@@ -201,6 +263,12 @@ private:
        * @param the matrix to be copied
        */
       matrix(const matrix<T> &);
+
+      /**
+       * Move Constructor
+       * @param the matrix to be moved, left empty
+       */
+      matrix(matrix<T> &&) noexcept;
       
       /// Destructor
       ~matrix();
@@ -212,6 +280,13 @@ private:
        */
       matrix<T>& operator=( const matrix<T>& );
 
+      /**
+       * Matrix move assignment
+       * @param right hand side matrix, left empty
+       * @return the left hand side matrix
+       */
+      matrix<T>& operator=( matrix<T>&& ) noexcept;
+
       /**
        * Equality comparison operator
        * @param rhs the right hand side matrix
@@ -234,6 +309,28 @@ private:
        */
       std::vector<T> getrow(size_type row) const;
       
+      /**
+       * A view of a row of the matrix that does not copy the elements
+       * @note does not check to ensure the row is in range
+       * @param row the row number
+       * @return a view of that row
+       */
+      vectorView<T> rowView(size_type row)
+      {
+          return vectorView<T>(elements.data() + calcLocation(row, 0), cols, bTranspose ? rows : 1);
+      }
+
+      /**
+       * A read-only view of a row of the matrix that does not copy the elements
+       * @note does not check to ensure the row is in range
+       * @param row the row number
+       * @return a view of that row
+       */
+      vectorView<const T> rowView(size_type row) const
+      {
+          return vectorView<const T>(elements.data() + calcLocation(row, 0), cols, bTranspose ? rows : 1);
+      }
+
       /**
        * Get a row of the matrix as a std::vector
        * @throws std::out_of_range when the row is not in range
@@ -266,6 +363,28 @@ private:
        */
       std::vector<T> getcol(size_type col) const;
       
+      /**
+       * A view of a column of the matrix that does not copy the elements
+       * @note does not check the array bounds
+       * @param col column number
+       * @return a view of the requested column
+       */
+      vectorView<T> colView(size_type col)
+      {
+          return vectorView<T>(elements.data() + calcLocation(0, col), rows, bTranspose ? 1 : cols);
+      }
+
+      /**
+       * A read-only view of a column of the matrix that does not copy the elements
+       * @note does not check the array bounds
+       * @param col column number
+       * @return a view of the requested column
+       */
+      vectorView<const T> colView(size_type col) const
+      {
+          return vectorView<const T>(elements.data() + calcLocation(0, col), rows, bTranspose ? 1 : cols);
+      }
+
       /**
        * Get a column of the matrix as a vector
        * @throws out_of_range error if the column requested is out of bounds
@@ -487,6 +606,140 @@ public:
     }
 };
 
+/**
+ * A view of matrix elements with the storage layout fixed at compile time
+ *
+ * The <code>matrix</code> class decides between row and column storage on
+ * every element access.  A view resolves the layout once, so element access
+ * is a single multiply-add that compilers can vectorize in inner loops.  The
+ * view does not own the elements and is invalidated when the matrix is
+ * resized, reassigned, or destroyed.
+ *
+ * @tparam T the type of object stored in the matrix, const qualified for a read-only view
+ * @tparam ROWMAJOR true if the elements of a row are contiguous, false if the
+ * elements of a column are contiguous
+ */
+template <class T, bool ROWMAJOR>
+class matrixView
+{
+public:
+    typedef size_t size_type; /**< define the size_type as std::vector */
+
+    /**
+     * Constructor
+     * @param data a pointer to the first element
+     * @param rows the number of rows
+     * @param cols the number of columns
+     * @param ld the leading dimension, the distance between the starts of
+     * consecutive rows when <code>ROWMAJOR</code> or columns otherwise
+     */
+    matrixView(T* data, size_type rows, size_type cols, size_type ld)
+        : m_data(data), m_rows(rows), m_cols(cols), m_ld(ld) {}
+
+    /// The number of rows in the view
+    size_type rowsize() const {return m_rows;};
+
+    /// The number of columns in the view
+    size_type colsize() const {return m_cols;};
+
+    /// The leading dimension of the view
+    size_type leadingDimension() const {return m_ld;};
+
+    /// a pointer to the first element
+    T* data() const {return m_data;};
+
+    /**
+     * A view of the transpose that shares the same elements
+     * @return the transposed view
+     */
+    matrixView<T, !ROWMAJOR> transposedView() const
+    {
+        return matrixView<T, !ROWMAJOR>(m_data, m_cols, m_rows, m_ld);
+    }
+
+    /**
+     * element access
+     * @note does not check for index in range
+     * @param row row index (zero based)
+     * @param col column index (zero based)
+     * @return a reference to the requested element
+     */
+    T & operator()(size_type row, size_type col) const
+    {
+        return ROWMAJOR ? m_data[row*m_ld + col] : m_data[col*m_ld + row];
+    }
+
+private:
+    T* m_data; /**< the first element */
+    size_type m_rows; /**< the number of rows */
+    size_type m_cols; /**< the number of columns */
+    size_type m_ld; /**< the leading dimension */
+};
+
+/**
+ * A view of a row or column of a matrix that does not copy the elements
+ *
+ * The elements are <code>stride</code> apart in the matrix storage, so a row
+ * of a matrix with contiguous rows has stride 1.  The view is invalidated
+ * when the matrix is resized, reassigned, or destroyed.
+ *
+ * @tparam T the type of object stored in the matrix, const qualified for a read-only view
+ */
+template <class T>
+class vectorView
+{
+public:
+    typedef size_t size_type; /**< define the size_type as std::vector */
+
+    /**
+     * Constructor
+     * @param data a pointer to the first element
+     * @param n the number of elements
+     * @param stride the distance between consecutive elements
+     */
+    vectorView(T* data, size_type n, size_type stride)
+        : m_data(data), m_size(n), m_stride(stride) {}
+
+    /// The number of elements in the view
+    size_type size() const {return m_size;};
+
+    /// The distance between consecutive elements in the matrix storage
+    size_type stride() const {return m_stride;};
+
+    /// a pointer to the first element
+    T* data() const {return m_data;};
+
+    /**
+     * element access
+     * @note does not check for index in range
+     * @param i the element index (zero based)
+     * @return a reference to the requested element
+     */
+    T & operator[](size_type i) const
+    {
+        return m_data[i*m_stride];
+    }
+
+    /**
+     * Copy the elements into a std::vector
+     * @return a vector of the elements
+     */
+    std::vector<typename std::remove_const<T>::type> toVector() const
+    {
+        std::vector<typename std::remove_const<T>::type> v(m_size);
+        for (size_type i = 0; i < m_size; i++)
+        {
+            v[i] = m_data[i*m_stride];
+        }
+        return v;
+    }
+
+private:
+    T* m_data; /**< the first element */
+    size_type m_size; /**< the number of elements */
+    size_type m_stride; /**< the distance between consecutive elements */
+};
+
 // heavily influenced by:  http://www.sj-vs.net/c-implementing-const_iterator-and-non-const-iterator-without-code-duplication/
 
 /******************************************************************************/
@@ -540,6 +793,16 @@ matrix<T>::matrix(const matrix<T> & cp)
 {
 }
 
+template<class T>
+matrix<T>::matrix(matrix<T> && mv) noexcept
+  : rows(mv.rows), cols(mv.cols), elements(std::move(mv.elements)), bTranspose(mv.bTranspose)
+{
+    mv.rows = 0;
+    mv.cols = 0;
+    mv.elements.clear();
+    mv.bTranspose = false;
+}
+
 template<class T>
 matrix<T>::~matrix()
 {
@@ -558,6 +821,23 @@ matrix<T>& matrix<T>::operator=( const matrix<T>& cp )
    return *this;
 }
 
+template<class T>
+matrix<T>& matrix<T>::operator=( matrix<T>&& mv ) noexcept
+{
+   if (this != &mv)
+   {
+       rows = mv.rows;
+       cols = mv.cols;
+       elements = std::move(mv.elements);
+       bTranspose = mv.bTranspose;
+       mv.rows = 0;
+       mv.cols = 0;
+       mv.elements.clear();
+       mv.bTranspose = false;
+   }
+   return *this;
+}
+
 template<class T>
 bool matrix<T>::operator==(const matrix<T>& cp) const
 {
@@ -37,28 +37,38 @@
  */
 namespace lhslib 
 {
-    void maximinLHS(int n, int k, int dup, bclib::matrix<int> & result, bclib::CRandom<double> & oRandom)
+    /**
+     * Build the maximin hypercube in integers of type T
+     * @param nsamples the number of points, n
+     * @param nparameters the number of dimensions, k
+     * @param duplication the number of candidate points for each point in the sample
+     * @param result the n x k hypercube, not transposed so that the coordinates of each point are contiguous
+     * @param oRandom the pseudo random number generator
+     * @param stats the statistics of the run, or <code>NULL</code>
+     * @tparam T the integer type of the working matrices
+     */
+    template <class T>
+    static void maximinLHSDesign(msize_type nsamples, msize_type nparameters, unsigned int duplication,
+        bclib::matrix<T> & result, bclib::CRandom<double> & oRandom, bclib::RunStatistics * stats)
     {
-        if (n < 1 || k < 1 || dup < 1)
-        {
-            throw std::runtime_error("nsamples are less than 1 (n) or nparameters less than 1 (k) or duplication is less than 1");
-        }
-        msize_type nsamples = static_cast<msize_type>(n);
-        msize_type nparameters = static_cast<msize_type>(k);
-        unsigned int duplication = static_cast<unsigned int>(dup);
-        if (result.rowsize() != nsamples || result.colsize() != nparameters)
-        {
-            throw std::runtime_error("result should be n x k for the lhslib::maximinLHS call");
-        }
-        result.transpose();
         // *****  matrix_unsafe<int> m_result = matrix_unsafe<int>(nparameters, nsamples, result);
         /* the length of the point1 columns and the list1 vector */
         msize_type len = duplication * (nsamples - 1);
         /* create memory space for computations */
-        bclib::matrix<int> avail = bclib::matrix<int>(nparameters, nsamples);
-        bclib::matrix<int> point1 = bclib::matrix<int>(nparameters, len);
-        std::vector<int> list1 = std::vector<int>(len);
-        std::vector<int> vec = std::vector<int>(nparameters);
+        bclib::matrix<T> availMatrix = bclib::matrix<T>(nparameters, nsamples);
+        bclib::matrix<T> point1Matrix = bclib::matrix<T>(nparameters, len);
+        std::vector<T> list1 = std::vector<T>(len);
+        /* views with a fixed layout so the inner loops index without branches.
+         * result is n x k with contiguous rows, the algorithm works on its k x n transpose */
+        bclib::matrixView<T, false> resultT = result.rowMajorView().transposedView();
+        bclib::matrixView<T, true> avail = availMatrix.rowMajorView();
+        bclib::matrixView<T, true> point1 = point1Matrix.rowMajorView();
+        /* the smallest squared distance from each candidate to the points in the sample */
+        std::vector<unsigned int> minCandidate = std::vector<unsigned int>(len);
+        /* the squared distances from one point in the sample to each candidate */
+        std::vector<uint32_t> distSquared = std::vector<uint32_t>(len);
+        /* the number of candidate points considered */
+        msize_type ncandidates;
         /* squared distance between corner (1,1,1,..) and (N,N,N,...) */
         double squaredDistanceBtwnCorners = static_cast<double>(nparameters * (nsamples - 1) * (nsamples - 1));
 
@@ -66,15 +76,20 @@ namespace lhslib
         vsize_type point_index;
         /* index of the optimum point */
         unsigned int best;
-        /* the squared distance between points */
-        unsigned int distSquared;
         /* the minimum squared distance between points */
         double minSquaredDistBtwnPts;
         /*  The minumum candidate squared difference between points */
         unsigned int minCandidateSquaredDistBtwnPts;
 
+        if (stats != NULL)
+        {
+            stats->addAllocation<T>(nparameters * nsamples + nparameters * len + len);
+            stats->addAllocation<unsigned int>(len);
+            stats->addAllocation<uint32_t>(len);
+        }
+
         /* initialize the avail matrix */
-        initializeAvailableMatrix(avail);
+        initializeAvailableMatrix(availMatrix);
 
         /*
         * come up with an array of K integers from 1 to N randomly
@@ -82,7 +97,7 @@ namespace lhslib
         */
         for (msize_type irow = 0; irow < nparameters; irow++)
         {
-            result(irow, nsamples-1) = static_cast<int>(std::floor(oRandom.getNextRandom() * static_cast<double>(nsamples) + 1.0));
+            resultT(irow, nsamples-1) = static_cast<T>(std::floor(oRandom.getNextRandom() * static_cast<double>(nsamples) + 1.0));
         }
 
         /*
@@ -91,7 +106,7 @@ namespace lhslib
         */
         for (unsigned int irow = 0; irow < nparameters; irow++)
         {
-            avail(irow, static_cast<unsigned int>(result(irow, nsamples - 1) - 1)) = static_cast<int>(nsamples);
+            avail(irow, static_cast<unsigned int>(resultT(irow, nsamples - 1) - 1)) = static_cast<T>(nsamples);
         }
 
         /* move backwards through the result matrix columns */
@@ -118,31 +133,32 @@ namespace lhslib
             }
             minSquaredDistBtwnPts = DBL_MIN;
             best = 0;
-            for (msize_type jcol = 0; jcol < duplication * ucount - 1; jcol++)
+            ncandidates = duplication * ucount - 1;
+            /* set min candidate equal to the maximum distance to start */
+            std::fill(minCandidate.begin(), minCandidate.begin() + ncandidates,
+                static_cast<unsigned int>(std::ceil(squaredDistanceBtwnCorners)));
+            for (msize_type j = ucount; j < nsamples; j++)
             {
-                /* set min candidate equal to the maximum distance to start */
-                minCandidateSquaredDistBtwnPts = static_cast<unsigned int>(std::ceil(squaredDistanceBtwnCorners));
-                for (msize_type j = ucount; j < nsamples; j++)
+                /*
+                * find the distance between the candidate points, stored one coordinate
+                * per row of point1, and a point already in the sample
+                */
+                distanceSquaredToBlock(&resultT(0, j), &point1(0, 0), ncandidates, nparameters, len, distSquared.data());
+                /*
+                * if the distance squared value is the smallest so far, place it in the
+                * min candidate
+                */
+                for (msize_type jcol = 0; jcol < ncandidates; jcol++)
                 {
-                    distSquared = 0;
-                    /*
-                    * find the distance between candidate points and the points already
-                    * in the sample
-                    */
-                    for (msize_type kindex= 0; kindex < nparameters; kindex++)
+                    if (minCandidate[jcol] > distSquared[jcol])
                     {
-                        vec[kindex] = point1(kindex, jcol) - result(kindex, j);
-                        distSquared += vec[kindex] * vec[kindex];
-                    }
-                    /*
-                    * if the distance squared value is the smallest so far, place it in the
-                    * min candidate
-                    */
-                    if (minCandidateSquaredDistBtwnPts > distSquared) 
-                    {
-                        minCandidateSquaredDistBtwnPts = distSquared;
+                        minCandidate[jcol] = distSquared[jcol];
                     }
                 }
+            }
+            for (msize_type jcol = 0; jcol < ncandidates; jcol++)
+            {
+                minCandidateSquaredDistBtwnPts = minCandidate[jcol];
                 /*
                 * if the candidate point is the largest minimum distance between points so
                 * far, then keep that point as the best.
@@ -154,17 +170,25 @@ namespace lhslib
                 }
             }
 
+            if (stats != NULL)
+            {
+                stats->candidatesScored += ncandidates;
+                stats->criterionEvaluations += ncandidates * (nsamples - ucount);
+                stats->acceptedMoves++;
+                stats->criterionTrajectory.push_back(minSquaredDistBtwnPts);
+            }
+
             /* take the best point out of point1 and place it in the result */
             for (msize_type irow = 0; irow < nparameters; irow++)
             {
-                result(irow, ucount-1) = point1(irow, best);
+                resultT(irow, ucount-1) = point1(irow, best);
             }
             /* update the numbers that are available for the future points */
             for (msize_type irow = 0; irow < nparameters; irow++)
             {
                 for (msize_type jcol = 0; jcol < nsamples; jcol++)
                 {
-                    if (avail(irow, jcol) == result(irow, ucount-1))
+                    if (avail(irow, jcol) == resultT(irow, ucount-1))
                     {
                         avail(irow, jcol) = avail(irow, ucount-1);
                     }
@@ -178,10 +202,69 @@ namespace lhslib
         */
         for (msize_type irow = 0; irow < nparameters; irow++)
         {
-            result(irow, 0u) = avail(irow, 0u);
+            resultT(irow, 0u) = avail(irow, 0u);
+        }
+
+    }
+
+    void maximinLHS(int n, int k, int dup, bclib::matrix<int> & result, bclib::CRandom<double> & oRandom)
+    {
+        maximinLHS(n, k, dup, result, oRandom, NULL);
+    }
+
+    void maximinLHS(int n, int k, int dup, bclib::matrix<int> & result, bclib::CRandom<double> & oRandom,
+        bclib::RunStatistics * stats)
+    {
+        if (n < 1 || k < 1 || dup < 1)
+        {
+            throw std::runtime_error("nsamples are less than 1 (n) or nparameters less than 1 (k) or duplication is less than 1");
+        }
+        msize_type nsamples = static_cast<msize_type>(n);
+        msize_type nparameters = static_cast<msize_type>(k);
+        unsigned int duplication = static_cast<unsigned int>(dup);
+        if (result.rowsize() != nsamples || result.colsize() != nparameters)
+        {
+            throw std::runtime_error("result should be n x k for the lhslib::maximinLHS call");
+        }
+        bclib::PhaseTimer buildTimer(stats, "build");
+        bclib::CountingRandom countedRandom(oRandom);
+        // draw through the counter only when the statistics are requested
+        bclib::CRandom<double> & drawRandom = (stats != NULL) ?
+            static_cast<bclib::CRandom<double> &>(countedRandom) : oRandom;
+        if (isNarrowDesignSize(nsamples))
+        {
+            /* build in 16 bit integers, which halves the memory traffic and doubles
+             * the candidates in each SIMD register of the distance kernels */
+            bclib::matrix<int16_t> narrowResult = bclib::matrix<int16_t>(nsamples, nparameters);
+            if (stats != NULL)
+            {
+                stats->addAllocation<int16_t>(nsamples * nparameters);
+            }
+            maximinLHSDesign(nsamples, nparameters, duplication, narrowResult, drawRandom, stats);
+            convertDesign(narrowResult, result);
+        }
+        else if (result.isTransposed())
+        {
+            /* the distance kernels need the coordinates of each point to be
+             * contiguous, so a result with contiguous columns is built in a copy */
+            bclib::matrix<int> rowResult = bclib::matrix<int>(nsamples, nparameters);
+            if (stats != NULL)
+            {
+                stats->addAllocation<int>(nsamples * nparameters);
+            }
+            maximinLHSDesign(nsamples, nparameters, duplication, rowResult, drawRandom, stats);
+            convertDesign(rowResult, result);
+        }
+        else
+        {
+            maximinLHSDesign(nsamples, nparameters, duplication, result, drawRandom, stats);
+        }
+        if (stats != NULL)
+        {
+            stats->randomDraws += countedRandom.draws();
         }
+        buildTimer.stop();
 
-        result.transpose();
     //#ifdef _DEBUG
         bool test = isValidLHS(result);
 
@@ -43,7 +43,8 @@ namespace oacpp
                 PRINT_OUTPUT << "be required to prove it.  This might take a long time.\n";
                 PRINT_OUTPUT << "This warning is triggered when more than " << BIGWORK << " comparisons\n";
                 PRINT_OUTPUT << "are required.  To avoid this warning increase BIGWORK in\n";
-                PRINT_OUTPUT << "oa.h.  Intermediate results will be printed.\n\n";
+                PRINT_OUTPUT << "oa.h.  Intermediate results will be printed.\n";
+                PRINT_OUTPUT << "OA_strt_sampled screens the array in bounded time.\n\n";
             }
             else if (work > MEDWORK)
             {
@@ -533,5 +534,178 @@ namespace oacpp
             }
             return SUCCESS_CHECK;
         }
+
+        /**
+         * Check one tuple of columns for strength t with one pass over the rows
+         * @param q the number of symbols
+         * @param A the orthogonal array
+         * @param clist the columns in the tuple
+         * @param lambda the number of times each tuple of symbols should occur
+         * @param counts scratch space for q^t counts
+         * @return true if every tuple of symbols occurs lambda times
+         */
+        static bool OA_tuplecheck(int q, const bclib::matrix<int> & A, const std::vector<int> & clist,
+            int lambda, std::vector<int> & counts)
+        {
+            std::fill(counts.begin(), counts.end(), 0);
+            for (size_t row = 0; row < A.rowsize(); row++)
+            {
+                size_t cell = 0;
+                for (size_t i = 0; i < clist.size(); i++)
+                {
+                    int value = A(row, static_cast<size_t>(clist[i]));
+                    if (value < 0 || value >= q)
+                    {
+                        return false;
+                    }
+                    cell = cell * static_cast<size_t>(q) + static_cast<size_t>(value);
+                }
+                counts[cell]++;
+            }
+            for (size_t cell = 0; cell < counts.size(); cell++)
+            {
+                if (counts[cell] != lambda)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * The sampled strength check for any source of uniform random numbers
+         * @see OA_strt_sampled
+         * @param drawUniforms called as <code>drawUniforms(unif)</code> to fill <code>unif</code> with uniform deviates
+         * @tparam U a function object
+         */
+        template <class U>
+        static int strtSampled(int q, const bclib::matrix<int> & A, int t, int samples,
+            double confidence, U drawUniforms, double * violationBound, int verbose)
+        {
+            size_t nrow = A.rowsize();
+            size_t ncol = A.colsize();
+            size_t ut = static_cast<size_t>(t);
+
+            if (t < 1 || static_cast<size_t>(t) > ncol)
+            {
+                throw std::runtime_error("The sampled strength check requires 1 <= t <= ncol");
+            }
+            if (samples < 1 || confidence <= 0.0 || confidence >= 1.0)
+            {
+                throw std::runtime_error("The sampled strength check requires samples >= 1 and 0 < confidence < 1");
+            }
+
+            *violationBound = 1.0;
+            double qtuples = pow(static_cast<double>(q), static_cast<double>(t));
+            if (qtuples > static_cast<double>(nrow) || nrow % static_cast<size_t>(qtuples) != 0)
+            {
+                if (verbose > 0) // LCOV_EXCL_START
+                {
+                    PRINT_OUTPUT << "The array cannot have strength " << t << ", because the number\n";
+                    PRINT_OUTPUT << "of rows " << nrow << " is not a multiple of q^" << t << " = " << qtuples << ".\n";
+                } // LCOV_EXCL_STOP
+                return FAILURE_CHECK;
+            }
+            int lambda = static_cast<int>(nrow / static_cast<size_t>(qtuples));
+            std::vector<int> counts(static_cast<size_t>(qtuples));
+            std::vector<int> clist(ut);
+
+            double ctuples = 1.0;
+            for (size_t i = 0; i < ut; i++)
+            {
+                ctuples *= static_cast<double>(ncol - i) / static_cast<double>(i + 1);
+            }
+
+            if (ctuples <= static_cast<double>(samples))
+            {
+                // every column tuple fits in the sample, so check them all in order
+                for (size_t i = 0; i < ut; i++)
+                {
+                    clist[i] = static_cast<int>(i);
+                }
+                while (true)
+                {
+                    if (!OA_tuplecheck(q, A, clist, lambda, counts))
+                    {
+                        return FAILURE_CHECK;
+                    }
+                    int i = t - 1; // has to be an int to decrement
+                    while (i >= 0 && clist[static_cast<size_t>(i)] == static_cast<int>(ncol) - t + i)
+                    {
+                        i--;
+                    }
+                    if (i < 0)
+                    {
+                        break;
+                    }
+                    clist[static_cast<size_t>(i)]++;
+                    for (size_t j = static_cast<size_t>(i) + 1; j < ut; j++)
+                    {
+                        clist[j] = clist[j - 1] + 1;
+                    }
+                }
+                *violationBound = 0.0;
+            }
+            else
+            {
+                std::vector<int> columns(ncol);
+                std::iota(columns.begin(), columns.end(), 0);
+                std::vector<double> unif(ut);
+                for (int s = 0; s < samples; s++)
+                {
+                    // a uniform random t-subset of the columns by a partial shuffle
+                    drawUniforms(unif);
+                    for (size_t i = 0; i < ut; i++)
+                    {
+                        size_t j = i + static_cast<size_t>(unif[i] * static_cast<double>(ncol - i));
+                        j = std::min(j, ncol - 1);
+                        std::swap(columns[i], columns[j]);
+                        clist[i] = columns[i];
+                    }
+                    if (!OA_tuplecheck(q, A, clist, lambda, counts))
+                    {
+                        if (verbose >= 2) // LCOV_EXCL_START
+                        {
+                            PRINT_OUTPUT << "Array is not of strength " << t << ".  A violation arises in columns (";
+                            for (size_t i = 0; i < ut; i++)
+                            {
+                                PRINT_OUTPUT << clist[i] << ((i == ut - 1) ? ").\n" : ",");
+                            }
+                        } // LCOV_EXCL_STOP
+                        return FAILURE_CHECK;
+                    }
+                }
+                *violationBound = 1.0 - pow(1.0 - confidence, 1.0 / static_cast<double>(samples));
+            }
+
+            if (verbose >= 2)
+            {
+                PRINT_OUTPUT << "No sampled column tuple violates strength " << t << ".  With confidence " << confidence // LCOV_EXCL_LINE
+                    << " at most " << *violationBound << " of the column tuples violate it.\n"; // LCOV_EXCL_LINE
+            }
+            return SUCCESS_CHECK;
+        }
+
+        int OA_strt_sampled(int q, const bclib::matrix<int> & A, int t, int samples,
+            double confidence, RUnif & oRandom, double * violationBound, int verbose)
+        {
+            return strtSampled(q, A, t, samples, confidence,
+                [&oRandom](std::vector<double> & unif) {oRandom.runif(unif, static_cast<int>(unif.size()));},
+                violationBound, verbose);
+        }
+
+        int OA_strt_sampled(int q, const bclib::matrix<int> & A, int t, int samples,
+            double confidence, bclib::CRandom<double> & oRandom, double * violationBound, int verbose)
+        {
+            return strtSampled(q, A, t, samples, confidence,
+                [&oRandom](std::vector<double> & unif)
+                {
+                    for (size_t i = 0; i < unif.size(); i++)
+                    {
+                        unif[i] = oRandom.getNextRandom();
+                    }
+                },
+                violationBound, verbose);
+        }
     } // end namespace
 }// end namespace
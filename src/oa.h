@@ -34,6 +34,8 @@
 #include "OACommonDefines.h"
 #include "primes.h"
 #include "matrix.h"
+#include "runif.h"
+#include "CRandom.h"
 
 /**
  *   If more than BIGWORK comparisons are required in
@@ -49,6 +51,10 @@
  * One tenth of the comparisons of BIGWORK
  */
 #define MEDWORK 10000000
+/**
+ * The default number of column tuples checked by the sampled strength check
+ */
+#define SAMPLEDSTR_DEFAULT_TUPLES 1000
 
 namespace oacpp {
     /**
@@ -133,6 +139,52 @@ namespace oacpp {
          * @return 
          */
 		int OA_strt(int q, const bclib::matrix<int> & A, int t, int verbose);
+
+        /**
+         * Check an arbitrary strength on a random sample of column tuples
+         *
+         * Each sampled tuple of t columns is checked exactly with one pass over
+         * the rows, so the work is bounded by <code>samples * (nrow + q^t)</code>
+         * and the memory by <code>q^t <= nrow</code> counts whatever the number
+         * of columns.  If every column tuple can be checked within the sample,
+         * they all are and the result is exact.
+         *
+         * When the sample passes, the fraction of column tuples that violate
+         * strength t is bounded by <code>1 - (1 - confidence)^(1/samples)</code>
+         * with the requested confidence.  A failure is a proven violation.
+         *
+         * @param q the number of symbols
+         * @param A the orthogonal array
+         * @param t the strength to check
+         * @param samples the number of column tuples to sample, for example
+         * <code>SAMPLEDSTR_DEFAULT_TUPLES</code>
+         * @param confidence the confidence level of the bound in (0, 1)
+         * @param oRandom the random number generator used to sample column tuples
+         * @param violationBound the upper bound on the fraction of violating column tuples,
+         * 0 if every tuple was checked, 1 if a violation was found
+         * @param verbose the level of messages
+         * @return SUCCESS_CHECK if no sampled tuple violates strength t
+         */
+		int OA_strt_sampled(int q, const bclib::matrix<int> & A, int t, int samples,
+            double confidence, RUnif & oRandom, double * violationBound, int verbose);
+
+        /**
+         * Check an arbitrary strength on a random sample of column tuples,
+         * sampling with a <code>bclib::CRandom</code> generator
+         * @see OA_strt_sampled(int, const bclib::matrix<int> &, int, int, double, RUnif &, double *, int)
+         * @param q the number of symbols
+         * @param A the orthogonal array
+         * @param t the strength to check
+         * @param samples the number of column tuples to sample
+         * @param confidence the confidence level of the bound in (0, 1)
+         * @param oRandom the random number generator used to sample column tuples
+         * @param violationBound the upper bound on the fraction of violating column tuples,
+         * 0 if every tuple was checked, 1 if a violation was found
+         * @param verbose the level of messages
+         * @return SUCCESS_CHECK if no sampled tuple violates strength t
+         */
+		int OA_strt_sampled(int q, const bclib::matrix<int> & A, int t, int samples,
+            double confidence, bclib::CRandom<double> & oRandom, double * violationBound, int verbose);
 	}
 }// end namespace
 
@@ -38,61 +38,110 @@ namespace oalhslib
     void oaLHS(int n, int k, const bclib::matrix<int> & oa, bclib::matrix<int> & intlhs,
             bclib::matrix<double> & lhs, bool bVerbose,
             bclib::CRandom<double> & oRandom)
+    {
+        oaLHS(n, k, oa, intlhs, lhs, bVerbose, oRandom, NULL);
+    }
+
+    void oaLHS(int n, int k, const bclib::matrix<int> & oa, bclib::matrix<int> & intlhs,
+            bclib::matrix<double> & lhs, bool bVerbose,
+            bclib::CRandom<double> & oRandom, bclib::RunStatistics * stats)
     {
         if (oa.rowsize() != static_cast<msize_type>(n) ||
                 oa.colsize() != static_cast<msize_type>(k))
         {
             throw std::runtime_error("the size of the orthogonal array does not match the n and k parameters");
         }
+        bclib::PhaseTimer levelsTimer(stats, "levels");
         if (intlhs.rowsize() != oa.rowsize() ||
                 intlhs.colsize() != oa.colsize())
         {
             intlhs = bclib::matrix<int>(oa.rowsize(), oa.colsize());
+            if (stats != NULL)
+            {
+                stats->addAllocation<int>(intlhs.rowsize() * intlhs.colsize());
+            }
         }
         if (lhs.rowsize() != oa.rowsize() ||
                 lhs.colsize() != oa.colsize())
         {
             lhs = bclib::matrix<double>(oa.rowsize(), oa.colsize());
+            if (stats != NULL)
+            {
+                stats->addAllocation<double>(lhs.rowsize() * lhs.colsize());
+            }
         }
         // iterate over the columns and make a list of the unique elements in the column
         std::vector<std::vector<int> > uniqueLevelsVector = std::vector<std::vector<int> >(oa.colsize());
         oalhslib::findUniqueColumnElements<int>(oa, uniqueLevelsVector);
+        if (stats != NULL)
+        {
+            for (vsize_type i = 0; i < uniqueLevelsVector.size(); i++)
+            {
+                stats->addAllocation<int>(uniqueLevelsVector[i].size());
+            }
+        }
+        levelsTimer.stop();
 
         if (bVerbose)
         {
             printOAandUnique(oa, uniqueLevelsVector); // LCOV_EXCL_LINE
         }
 
-        replaceOAValues(oa, uniqueLevelsVector, intlhs, oRandom, true);
-
-		if (bVerbose)
-		{
-			PRINT_OUTPUT << "\ninteger lhs:\n" << intlhs.toString() << "\n"; // LCOV_EXCL_LINE
-		}
-
-		// transform integer hypercube to a double hypercube
-        for (msize_type jcol = 0; jcol < static_cast<msize_type>(k); jcol++)
+        // draw an independent seed for each column from the serial generator so that the
+        //   columns can be converted in parallel and the result depends only on oRandom
+        bclib::PhaseTimer convertTimer(stats, "convert");
+        std::vector<unsigned int> seeds(2 * static_cast<vsize_type>(k));
+        for (vsize_type i = 0; i < seeds.size(); i++)
         {
-            for (msize_type irow = 0; irow < static_cast<msize_type>(n); irow++)
+            seeds[i] = static_cast<unsigned int>(oRandom.getNextRandom() * 4294967296.0);
+            // a zero seed is a fixed point of the generator
+            if (seeds[i] == 0)
             {
-                lhs(irow, jcol) = static_cast<double>(intlhs(irow, jcol)) - 1.0;
+                seeds[i] = 1; // LCOV_EXCL_LINE
             }
         }
-		
-		int veclen = n * k;
-        std::vector<double> randomunif = std::vector<double>(veclen);
-        for (vsize_type i = 0; i < static_cast<vsize_type>(veclen); i++)
+
+        // each thread converts a contiguous range of columns
+        unsigned int nthreads = bclib::threadsForWork(static_cast<size_t>(n) * static_cast<size_t>(k),
+            OALHS_MIN_VALUES_PER_THREAD);
+        bclib::parallelForRange(static_cast<size_t>(k), nthreads,
+            [&oa, &uniqueLevelsVector, &seeds, &intlhs, &lhs](size_t firstCol, size_t lastCol)
+            {
+                convertOAColumns(oa, uniqueLevelsVector, seeds, intlhs, lhs,
+                    static_cast<msize_type>(firstCol), static_cast<msize_type>(lastCol));
+            });
+        if (stats != NULL)
         {
-            randomunif[i] = oRandom.getNextRandom();
+            // each column stream orders and jitters every row of its column
+            stats->randomDraws += seeds.size() + 2 * static_cast<size_t>(n) * static_cast<size_t>(k);
+            stats->addAllocation<unsigned int>(seeds.size());
         }
-        
-		bclib::matrix<double> randomMatrix(n, k, randomunif);
-        for (msize_type jcol = 0; jcol < static_cast<msize_type>(k); jcol++)
+        convertTimer.stop();
+
+		if (bVerbose)
+		{
+			PRINT_OUTPUT << "\ninteger lhs:\n" << intlhs.toString() << "\n"; // LCOV_EXCL_LINE
+		}
+    }
+
+    void convertOAColumns(const bclib::matrix<int> & oa,
+        const std::vector<std::vector<int> > & uniqueLevelsVector,
+        const std::vector<unsigned int> & seeds,
+        bclib::matrix<int> & intlhs,
+        bclib::matrix<double> & lhs,
+        msize_type firstCol, msize_type lastCol)
+    {
+        OAColumnScratch scratch;
+        bclib::CRandomStandardUniform columnRandom;
+        double dn = static_cast<double>(oa.rowsize());
+        for (msize_type jcol = firstCol; jcol < lastCol; jcol++)
         {
-            for (msize_type irow = 0; irow < static_cast<msize_type>(n); irow++)
+            columnRandom.setSeed(seeds[2 * jcol], seeds[2 * jcol + 1]);
+            replaceOAColumn(oa, jcol, uniqueLevelsVector[jcol], intlhs, columnRandom, true, scratch);
+            // transform the integer column to a double column with jitter inside each cell
+            for (msize_type irow = 0; irow < oa.rowsize(); irow++)
             {
-                lhs(irow,jcol) += randomMatrix(irow, jcol);
-                lhs(irow,jcol) /= static_cast<double>(n);
+                lhs(irow, jcol) = (static_cast<double>(intlhs(irow, jcol)) - 1.0 + columnRandom.getNextRandom()) / dn;
             }
         }
     }
@@ -148,273 +197,172 @@ namespace oalhslib
         bclib::CRandom<double> & oRandom,
         bool isRandom)
     {
-        int basecount = 1;
-        std::vector<int> randints;
-        std::vector<double> randdouble;
+        // scratch space is reused for every column
+        OAColumnScratch scratch;
         for (msize_type i = 0; i < oa.colsize(); i++)
         {
-            // reset the basecount for each column
-            basecount = 1;
-            for (vconstiterator vit = uniqueLevelsVector[i].begin(); vit != uniqueLevelsVector[i].end(); ++vit)
-            {
-                // count the number of times this value is in the oa column
-                int tempcount = (int) std::count(oa.columnwisebegin(i), oa.columnwiseend(i), *vit);
-                randints = std::vector<int>(tempcount);
-                if (isRandom)
-                {
-                    randdouble = std::vector<double>(tempcount);
-                    // get a random ordering for the digits
-                    for (std::vector<double>::iterator itt = randdouble.begin(); itt != randdouble.end(); ++itt)
-                    {
-                        *itt = oRandom.getNextRandom();
-                    }
-                    //lhslib::runif_std(tempcount, randdouble, oRandom);
-                    bclib::findorder_zero(randdouble, randints);
-                }
-                else
-                {
-                    for (int count = 0; count < tempcount; count++)
-                    {
-                        randints[count] = count;
-                    }
-                }
-                // replace the elements of intlhs corresponding to the current unique value
-                viterator randintsit = randints.begin();
-                for (msize_type irow = 0; irow < oa.rowsize(); irow++)
-                {
-                    if (oa(irow, i) == *vit && randintsit != randints.end())
-                    {
-                        intlhs(irow, i) = basecount + *randintsit;
-                        ++randintsit;
-                    }
-                }
-                basecount += tempcount;
-            }
+            replaceOAColumn(oa, i, uniqueLevelsVector[i], intlhs, oRandom, isRandom, scratch);
         }
     }
 
-    void generateOALHS(int n, int k, bclib::matrix<double> & oalhs,
-        bool bChooseLargerDesign, bool bVerbose,
-		bclib::CRandom<double> & oRandom)
+    void replaceOAColumn(const bclib::matrix<int> & oa, msize_type i,
+        const std::vector<int> & levels,
+        bclib::matrix<int> & intlhs,
+        bclib::CRandom<double> & oRandom,
+        bool isRandom,
+        OAColumnScratch & scratch)
     {
-        if (bVerbose)
+        msize_type nrow = oa.rowsize();
+        vsize_type nlevels = levels.size();
+        if (nlevels == 0)
         {
-			PRINT_OUTPUT << "\n"; // LCOV_EXCL_LINE
+            return;
         }
-        int q_addelkemp = bChooseLargerDesign ? (int) ceil(sqrt((double) n / 2.0)) : (int) floor(sqrt((double) n / 2.0));
-        while (oacpp::primes::isprimepow(q_addelkemp) == 0 && q_addelkemp >= 2)
+        std::vector<int> & levelOfRow = scratch.levelOfRow;
+        std::vector<msize_type> & rowsByLevel = scratch.rowsByLevel;
+        std::vector<msize_type> & levelStart = scratch.levelStart;
+        std::vector<int> & levelLookup = scratch.levelLookup;
+        std::map<int, int> & sparseLevelLookup = scratch.sparseLevelLookup;
+        std::vector<std::pair<double, int> > & randpairs = scratch.randpairs;
+        levelOfRow.resize(nrow);
+        rowsByLevel.resize(nrow);
+
+        // map each oa value to the position of its level in the unique levels,
+        //   with a dense table when the levels are a compact range of integers
+        int minLevel = *std::min_element(levels.begin(), levels.end());
+        int maxLevel = *std::max_element(levels.begin(), levels.end());
+        long long levelRange = static_cast<long long>(maxLevel) - static_cast<long long>(minLevel) + 1;
+        bool bDense = levelRange <= static_cast<long long>(std::max<msize_type>(nrow, 1024));
+        if (bDense)
         {
-            if (bChooseLargerDesign)
+            levelLookup.assign(static_cast<vsize_type>(levelRange), -1);
+            for (vsize_type l = 0; l < nlevels; l++)
             {
-                q_addelkemp++;
-            }
-            else
-            {
-                q_addelkemp--;
+                levelLookup[static_cast<vsize_type>(levels[l] - minLevel)] = static_cast<int>(l);
             }
         }
-        int n_addelkemp = 2*q_addelkemp*q_addelkemp;
-        int k_addelkemp = k < 2*q_addelkemp + 1 ? k : 2*q_addelkemp + 1;
-        if (bVerbose)
+        else
         {
-			PRINT_OUTPUT << "Candidate OA:  AddelKemp with q=" << q_addelkemp << " n=" << n_addelkemp << " k=" << k_addelkemp << "\n"; // LCOV_EXCL_LINE
+            sparseLevelLookup.clear();
+            for (vsize_type l = 0; l < nlevels; l++)
+            {
+                sparseLevelLookup[levels[l]] = static_cast<int>(l);
+            }
         }
 
-        int q_addelkemp3 = bChooseLargerDesign ? (int) ceil(pow((double) n / 2.0, 1.0/3.0)) : (int) floor(pow((double) n / 2.0, 1.0/3.0));
-        while (oacpp::primes::isprimepow(q_addelkemp3) == 0 && q_addelkemp3 >= 2)
+        // count the rows of each level in one pass over the column
+        levelStart.assign(nlevels + 1, 0);
+        for (msize_type irow = 0; irow < nrow; irow++)
         {
-            if (bChooseLargerDesign)
+            int value = oa(irow, i);
+            int level = -1;
+            if (bDense)
             {
-                q_addelkemp3++;
+                if (value >= minLevel && value <= maxLevel)
+                {
+                    level = levelLookup[static_cast<vsize_type>(value - minLevel)];
+                }
             }
             else
             {
-                q_addelkemp3--;
+                std::map<int, int>::const_iterator it = sparseLevelLookup.find(value);
+                if (it != sparseLevelLookup.end())
+                {
+                    level = it->second;
+                }
+            }
+            levelOfRow[irow] = level;
+            if (level >= 0)
+            {
+                levelStart[static_cast<vsize_type>(level) + 1]++;
             }
         }
-        int n_addelkemp3 = 2*q_addelkemp3*q_addelkemp3*q_addelkemp3;
-        int k_addelkemp3 = k < 2*q_addelkemp3*q_addelkemp3 + 2*q_addelkemp3 + 1 ? k : 2*q_addelkemp3*q_addelkemp3 + 2*q_addelkemp3 + 1;
-        if (bVerbose)
+        for (vsize_type l = 0; l < nlevels; l++)
         {
-			PRINT_OUTPUT << "Candidate OA:  AddelKemp3 with q=" << q_addelkemp3 << " n=" << n_addelkemp3 << " k=" << k_addelkemp3 << "\n"; // LCOV_EXCL_LINE
+            levelStart[l + 1] += levelStart[l];
         }
 
-        int q_bose = bChooseLargerDesign ? (int) ceil(sqrt((double) n)) : (int) floor(sqrt((double) n));
-        while (oacpp::primes::isprimepow(q_bose) == 0 && q_bose >= 2)
+        // bucket the rows by level, keeping the rows of each level in order
+        for (msize_type irow = 0; irow < nrow; irow++)
         {
-            if (bChooseLargerDesign)
-            {
-                q_bose++;
-            }
-            else
+            if (levelOfRow[irow] >= 0)
             {
-                q_bose--;
+                vsize_type l = static_cast<vsize_type>(levelOfRow[irow]);
+                rowsByLevel[levelStart[l]++] = irow;
             }
         }
-        int n_bose = q_bose*q_bose;
-        int k_bose = k < q_bose + 1 ? k : q_bose + 1;
-        if (bVerbose)
+        // the bucketing advanced each start to the start of the next level
+        for (vsize_type l = nlevels; l > 0; l--)
         {
-			PRINT_OUTPUT << "Candidate OA:  Bose with q=" << q_bose << " n=" << n_bose << " k=" << k_bose << "\n"; // LCOV_EXCL_LINE
+            levelStart[l] = levelStart[l - 1];
         }
+        levelStart[0] = 0;
 
-        int q_bosebush = bChooseLargerDesign ? static_cast<int>(ceil(sqrt((double) n / 2.0))) : static_cast<int>(floor(sqrt((double) n / 2.0)));
-        if (q_bosebush % 2 != 0)
+        // replace the rows of each level with a random ordering of its block of integers
+        int basecount = 1;
+        for (vsize_type l = 0; l < nlevels; l++)
         {
-            if (bChooseLargerDesign)
+            msize_type first = levelStart[l];
+            msize_type tempcount = levelStart[l + 1] - first;
+            if (isRandom)
             {
-                q_bosebush++;
+                randpairs.resize(tempcount);
+                for (msize_type m = 0; m < tempcount; m++)
+                {
+                    randpairs[m] = std::pair<double, int>(oRandom.getNextRandom(), static_cast<int>(m));
+                }
+                // the same ordering as bclib::findorder_zero
+                std::sort(randpairs.begin(), randpairs.end(), bclib::findranksCompare<double>);
+                for (msize_type m = 0; m < tempcount; m++)
+                {
+                    intlhs(rowsByLevel[first + m], i) = basecount + randpairs[m].second;
+                }
             }
             else
             {
-                q_bosebush--;
+                for (msize_type m = 0; m < tempcount; m++)
+                {
+                    intlhs(rowsByLevel[first + m], i) = basecount + static_cast<int>(m);
+                }
             }
+            basecount += static_cast<int>(tempcount);
         }
-        int n_bosebush = 2*q_bosebush*q_bosebush;
-        int k_bosebush = k < q_bosebush + 1 ? k : q_bosebush + 1;
+    }
+
+    void generateOALHS(int n, int k, bclib::matrix<double> & oalhs,
+        bool bChooseLargerDesign, bool bVerbose,
+		bclib::CRandom<double> & oRandom)
+    {
+        generateOALHS(n, k, oalhs, bChooseLargerDesign, bVerbose, oRandom, NULL);
+    }
+
+    void generateOALHS(int n, int k, bclib::matrix<double> & oalhs,
+        bool bChooseLargerDesign, bool bVerbose,
+		bclib::CRandom<double> & oRandom, bclib::RunStatistics * stats)
+    {
         if (bVerbose)
         {
-			PRINT_OUTPUT << "Candidate OA:  BoseBush with q=" << q_bosebush << " n=" << n_bosebush << " k=" << k_bosebush << "\n"; // LCOV_EXCL_LINE
+			PRINT_OUTPUT << "\n"; // LCOV_EXCL_LINE
         }
 
-		// Goal:  Find the n and k that are the closest with atleast the required n and k
-        std::vector<std::string> types = std::vector<std::string>();
-        std::vector<int> ndiffs = std::vector<int>();
-		std::vector<int> ks = std::vector<int>();
-		std::vector<int> ns = std::vector<int>();
-        types.push_back("addelkemp");
-        types.push_back("addelkemp3");
-        types.push_back("bose");
-        types.push_back("bosebush");
-		ks.push_back(k_addelkemp);
-		ks.push_back(k_addelkemp3);
-		ks.push_back(k_bose);
-		ks.push_back(k_bosebush);
-		ns.push_back(n_addelkemp);
-		ns.push_back(n_addelkemp3);
-		ns.push_back(n_bose);
-		ns.push_back(n_bosebush);
-		// if atleast one of the models has a greater n
-		if (n_addelkemp >= n || n_addelkemp3 >= n || n_bose >= n || n_bosebush >= n)
-		{
-			ndiffs.push_back((n_addelkemp >= n) ? n_addelkemp - n : (n - n_addelkemp) * 100);
-			ndiffs.push_back((n_addelkemp3 >= n) ? n_addelkemp3 - n : (n - n_addelkemp3) * 100);
-			ndiffs.push_back((n_bose >= n) ? n_bose - n : (n - n_bose) * 100);
-			ndiffs.push_back((n_bosebush >= n) ? n_bosebush - n : (n - n_bosebush) * 100);
-		}
-		else
-		{
-			ndiffs.push_back(static_cast<int>(fabs(static_cast<double>(n) - static_cast<double>(n_addelkemp))));
-			ndiffs.push_back(static_cast<int>(fabs(static_cast<double>(n) - static_cast<double>(n_addelkemp3))));
-			ndiffs.push_back(static_cast<int>(fabs(static_cast<double>(n) - static_cast<double>(n_bose))));
-			ndiffs.push_back(static_cast<int>(fabs(static_cast<double>(n) - static_cast<double>(n_bosebush))));
-		}
-
-        // which is the smallest?
-        std::vector<int> norders = std::vector<int>(ndiffs.size());
-        bclib::findorder_zero(ndiffs, norders);
+        bclib::PhaseTimer planTimer(stats, "plan");
+        OADesignPlan plan = planOADesign(n, k, bChooseLargerDesign, bVerbose);
+        planTimer.stop();
         oacpp::COrthogonalArray coa = oacpp::COrthogonalArray();
-
-		std::string selected;
-		if (ks[norders[0]] >= k)
-		{
-			selected = types[norders[0]];
-		}
-		else if (ks[norders[1]] >= k && ns[norders[1]] >= n)
-		{
-			selected = types[norders[1]];
-		}
-		else if (ks[norders[2]] >= k && ns[norders[2]] >= n)
-		{
-			selected = types[norders[2]];
-		}
-		else if (ks[norders[3]] >= k && ns[norders[3]] >= n)
-		{
-			selected = types[norders[3]];
-		}
-		else
-		{
-			selected = types[norders[0]];
-		}
-
-        if (selected == "addelkemp")
-        {
-            if (bVerbose)
-            {
-				PRINT_OUTPUT << "AddelKemp selected\n"; // LCOV_EXCL_LINE
-            }
-            coa.addelkemp(q_addelkemp, k_addelkemp, &n_addelkemp);
-        }
-        else if (selected == "addelkemp3")
-        {
-            if (bVerbose)
-            {
-				PRINT_OUTPUT << "AddelKemp3 selected\n"; // LCOV_EXCL_LINE
-            }
-            coa.addelkemp3(q_addelkemp3, k_addelkemp3, &n_addelkemp3);
-        }
-        else if (selected == "bose")
-        {
-            if (bVerbose)
-            {
-				PRINT_OUTPUT << "Bose selected\n"; // LCOV_EXCL_LINE
-            }
-            coa.bose(q_bose, k_bose, &n_bose);
-        }
-        else if (selected == "bosebush")
-        {
-            if (bVerbose)
-            {
-				PRINT_OUTPUT << "BoseBush selected\n"; // LCOV_EXCL_LINE
-            }
-            coa.bosebush(q_bosebush, k_bosebush, &n_bosebush);
-        }
+        coa.setStatistics(stats);
+        buildOADesign(plan, coa);
 
 		bclib::matrix<int> oa = coa.getoa();
 		bclib::matrix<int> intoalhs = bclib::matrix<int>(oa.rowsize(), oa.colsize());
 		oalhs = bclib::matrix<double>(oa.rowsize(), oa.colsize());
 
-		// iterate over the columns and make a list of the unique elements in the column
-		std::vector<std::vector<int> > uniqueLevelsVector = std::vector<std::vector<int> >(oa.colsize());
-		oalhslib::findUniqueColumnElements<int>(oa, uniqueLevelsVector);
-
-		if (bVerbose)
-		{
-			printOAandUnique(oa, uniqueLevelsVector); // LCOV_EXCL_LINE
-		}
-
-		replaceOAValues(oa, uniqueLevelsVector, intoalhs, oRandom, true);
-
-		if (bVerbose)
-		{
-			PRINT_OUTPUT << "\ninteger lhs:\n" << intoalhs.toString() << "\n"; // LCOV_EXCL_LINE
-		}
-
-		// transform integer hypercube to a double hypercube
-		for (msize_type jcol = 0; jcol < intoalhs.colsize(); jcol++)
-		{
-			for (msize_type irow = 0; irow < intoalhs.rowsize(); irow++)
-			{
-				oalhs(irow, jcol) = static_cast<double>(intoalhs(irow, jcol)) - 1.0;
-			}
-		}
-
-		size_t veclen = intoalhs.colsize() * intoalhs.rowsize();
-		std::vector<double> randomunif = std::vector<double>(veclen);
-		for (vsize_type i = 0; i < veclen; i++)
+		if (stats != NULL)
 		{
-			randomunif[i] = oRandom.getNextRandom();
+			stats->addAllocation<int>(2 * oa.rowsize() * oa.colsize());
+			stats->addAllocation<double>(oa.rowsize() * oa.colsize());
 		}
 
-		bclib::matrix<double> randomMatrix(intoalhs.rowsize(), intoalhs.colsize(), randomunif);
-		for (msize_type jcol = 0; jcol < intoalhs.colsize(); jcol++)
-		{
-			for (msize_type irow = 0; irow < intoalhs.rowsize(); irow++)
-			{
-				oalhs(irow, jcol) += randomMatrix(irow, jcol);
-				oalhs(irow, jcol) /= static_cast<double>(intoalhs.rowsize());
-			}
-		}
+		oaLHS(static_cast<int>(oa.rowsize()), static_cast<int>(oa.colsize()), oa, intoalhs, oalhs, bVerbose, oRandom, stats);
 	}
 
 }
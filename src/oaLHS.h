@@ -28,11 +28,44 @@
 #include "order.h"
 #include "oaLHSUtility.h"
 #include "COrthogonalArray.h"
+#include "oaPlanner.h"
+#include "parallelFor.h"
+#include <map>
+
+/**
+ * The minimum number of Latin hypercube values converted by each thread
+ */
+#define OALHS_MIN_VALUES_PER_THREAD 65536
 
 namespace oalhslib
 {
+    /**
+     * Scratch space for replacing the values in one orthogonal array column,
+     * kept between columns to avoid reallocation
+     */
+    struct OAColumnScratch
+    {
+        /** the position of the level of each row in the unique levels */
+        std::vector<int> levelOfRow;
+        /** the rows ordered by level */
+        std::vector<bclib::matrix<int>::size_type> rowsByLevel;
+        /** the first entry of each level in rowsByLevel */
+        std::vector<bclib::matrix<int>::size_type> levelStart;
+        /** the position of each level in a compact range of levels */
+        std::vector<int> levelLookup;
+        /** the position of each level when the levels are not a compact range */
+        std::map<int, int> sparseLevelLookup;
+        /** random values and their original positions */
+        std::vector<std::pair<double, int> > randpairs;
+    };
+
     /**
      * create an orthogonal array latin hypercube from an orthogonal array
+     *
+     * Each column is converted with its own random stream seeded from
+     * <code>oRandom</code>, so large designs are converted on several threads
+     * with a result that depends only on <code>oRandom</code>.
+     *
      * @param n the number of rows or samples
      * @param k the number of columns or parameters
      * @param oa an orthogonal array
@@ -46,6 +79,27 @@ namespace oalhslib
             bclib::matrix<double> & lhs, bool bVerbose,
             bclib::CRandom<double> & oRandom);
 
+    /**
+     * create an orthogonal array latin hypercube from an orthogonal array with run statistics
+     *
+     * The conversion does not evaluate a criterion.  The statistics hold the
+     * phases, the storage, and the random numbers drawn from
+     * <code>oRandom</code> and from the column streams.
+     *
+     * @param n the number of rows or samples
+     * @param k the number of columns or parameters
+     * @param oa an orthogonal array
+     * @param intlhs an integer based Latin hypercube sample
+     * @param lhs a Latin hypercube sample
+     * @param bVerbose will messages be printed
+     * @param oRandom a random generator
+     * @param stats the statistics of the run, or <code>NULL</code>
+     */
+    void oaLHS(int n, int k, const bclib::matrix<int> & oa,
+            bclib::matrix<int> & intlhs,
+            bclib::matrix<double> & lhs, bool bVerbose,
+            bclib::CRandom<double> & oRandom, bclib::RunStatistics * stats);
+
     /**
      * create a deterministic orthogonal array latin hypercube from an orthogonal array
      * @param n the number of rows or samples
@@ -80,8 +134,48 @@ namespace oalhslib
         bclib::CRandom<double> & oRandom,
         bool isRandom);
 
+    /**
+     * replace the values in one orthogonal array column
+     * @param oa an orthogonal array
+     * @param col the column to replace
+     * @param levels the unique levels of the column
+     * @param intlhs an integer based Latin hypercube sample
+     * @param oRandom a random number generator
+     * @param isRandom is the result randomized
+     * @param scratch scratch space reused between columns
+     */
+    void replaceOAColumn(const bclib::matrix<int> & oa,
+        bclib::matrix<int>::size_type col,
+        const std::vector<int> & levels,
+        bclib::matrix<int> & intlhs,
+        bclib::CRandom<double> & oRandom,
+        bool isRandom,
+        OAColumnScratch & scratch);
+
+    /**
+     * convert a range of orthogonal array columns to Latin hypercube columns
+     * @param oa an orthogonal array
+     * @param uniqueLevelsVector the unique levels of each column
+     * @param seeds two random seeds for each column
+     * @param intlhs an integer based Latin hypercube sample
+     * @param lhs a Latin hypercube sample
+     * @param firstCol the first column in the range
+     * @param lastCol one past the last column in the range
+     */
+    void convertOAColumns(const bclib::matrix<int> & oa,
+        const std::vector<std::vector<int> > & uniqueLevelsVector,
+        const std::vector<unsigned int> & seeds,
+        bclib::matrix<int> & intlhs,
+        bclib::matrix<double> & lhs,
+        bclib::matrix<int>::size_type firstCol,
+        bclib::matrix<int>::size_type lastCol);
+
     /**
      * generate an orthogonal array Latin hypercube
+     *
+     * The orthogonal array is chosen by <code>planOADesign</code> from every
+     * construction in the library.
+     *
      * @param n the number of rows or samples
      * @param k the number of columns or parameters
      * @param oalhs the generated Latin hypercube sample
@@ -92,6 +186,24 @@ namespace oalhslib
     void generateOALHS(int n, int k, bclib::matrix<double> & oalhs,
         bool bChooseLargerDesign, bool bVerbose,
 		bclib::CRandom<double> & oRandom);
+
+    /**
+     * generate an orthogonal array Latin hypercube with run statistics
+     *
+     * The statistics hold the <code>plan</code> phase and those of the
+     * orthogonal array construction and of <code>oaLHS</code>.
+     *
+     * @param n the number of rows or samples
+     * @param k the number of columns or parameters
+     * @param oalhs the generated Latin hypercube sample
+     * @param bChooseLargerDesign choose a larger design if the orthogonal array is not sufficient
+     * @param bVerbose should messages be printed
+     * @param oRandom a random generator
+     * @param stats the statistics of the run, or <code>NULL</code>
+     */
+    void generateOALHS(int n, int k, bclib::matrix<double> & oalhs,
+        bool bChooseLargerDesign, bool bVerbose,
+		bclib::CRandom<double> & oRandom, bclib::RunStatistics * stats);
 }
 
 
@@ -23,6 +23,7 @@
 #define	OALHSUTILITY_H
 
 #include <vector>
+#include <set>
 
 namespace oalhslib
 {
@@ -40,13 +41,15 @@ namespace oalhslib
         {
             U = std::vector<std::vector<T> >(A.colsize());
         }
+        // the set is only used for lookups; U keeps the order of first appearance
+        std::set<T> seen;
         for (typename bclib::matrix<T>::size_type i = 0; i < A.colsize(); i++)
         {
-            U[i] = std::vector<T>();
+            U[i].clear();
+            seen.clear();
             for (typename bclib::matrix<T>::const_columnwise_iterator it = A.columnwisebegin(i); it != A.columnwiseend(i); ++it)
             {
-                typename std::vector<T>::iterator tempit = std::find(U[i].begin(), U[i].end(), *it);
-                if (tempit ==  U[i].end())
+                if (seen.insert(*it).second)
                 {
                     U[i].push_back(*it);
                 }
@@ -0,0 +1,242 @@
+/**
+ * @file oaPlanner.cpp
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License: <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "oaPlanner.h"
+#include <limits>
+
+namespace oalhslib
+{
+    /**
+     * Add a candidate design if it is within the row limit
+     * @param candidates the list of candidates
+     * @param type the construction
+     * @param q the number of levels
+     * @param param the construction parameter
+     * @param nrow the number of rows
+     * @param maxcol the maximum number of columns
+     * @param k the requested number of columns
+     * @param opsPerElement the number of Galois field operations per array element
+     * @param fieldOrder the order of the Galois field used in the construction
+     * @param rowLimit the maximum number of rows to consider
+     */
+    static void addCandidate(std::vector<OADesignPlan> & candidates, const std::string & type,
+        int q, int param, long long nrow, long long maxcol, int k, int opsPerElement,
+        int fieldOrder, long long rowLimit)
+    {
+        if (nrow > rowLimit)
+        {
+            return;
+        }
+        OADesignPlan plan;
+        plan.type = type;
+        plan.q = q;
+        plan.param = param;
+        plan.nrow = nrow;
+        plan.maxcol = static_cast<int>(std::min<long long>(maxcol, std::numeric_limits<int>::max()));
+        // COrthogonalArray constructs every available column when fewer than two are requested
+        plan.ncol = (k < 2) ? plan.maxcol : std::min(k, plan.maxcol);
+        // the array elements dominate the work of construction and conversion, the field tables are built once
+        plan.cost = static_cast<double>(nrow) * static_cast<double>(plan.ncol) * static_cast<double>(opsPerElement) +
+            static_cast<double>(fieldOrder) * static_cast<double>(fieldOrder);
+        candidates.push_back(plan);
+    }
+
+    std::vector<OADesignPlan> enumerateOADesigns(int n, int k)
+    {
+        if (n < 1 || k < 1)
+        {
+            throw std::runtime_error("n and k must be positive to plan an orthogonal array");
+        }
+
+        // the smallest Bose design meeting the request bounds the search
+        int qmax = std::max(2, std::max(static_cast<int>(ceil(sqrt(static_cast<double>(n)))), k - 1));
+        while (oacpp::primes::isprimepow(qmax) == 0)
+        {
+            qmax++;
+        }
+        long long rowLimit = std::max(static_cast<long long>(qmax) * static_cast<long long>(qmax),
+            static_cast<long long>(n));
+
+        std::vector<OADesignPlan> candidates;
+        for (int q = 2; q <= qmax; q++)
+        {
+            int p, pn, isppq;
+            oacpp::primes::primepow(q, &p, &pn, &isppq);
+            if (isppq == 0)
+            {
+                continue;
+            }
+            long long lq = static_cast<long long>(q);
+            // Addelman-Kempthorne constructions are only available for odd q and q <= 4
+            bool bAddelKemp = (p != 2 || q <= 4);
+
+            addCandidate(candidates, "bose", q, 0, lq * lq, lq + 1, k, 1, q, rowLimit);
+
+            // Bush designs need str <= ncol and str < q + 1
+            long long rows = lq * lq * lq;
+            for (int str = 3; str <= q && str <= k && rows <= rowLimit; str++, rows *= lq)
+            {
+                addCandidate(candidates, "busht", q, str, rows, lq + 1, k, str, q, rowLimit);
+            }
+
+            if (bAddelKemp)
+            {
+                addCandidate(candidates, "addelkemp", q, 0, 2 * lq * lq, 2 * lq + 1, k, 2, q, rowLimit);
+                if (q != 8)
+                {
+                    addCandidate(candidates, "addelkemp3", q, 0, 2 * lq * lq * lq,
+                        2 * lq * lq + 2 * lq + 1, k, 3, q, rowLimit);
+                }
+                long long qpow = lq * lq * lq * lq;
+                for (int akn = 4; 2 * qpow <= rowLimit; akn++, qpow *= lq)
+                {
+                    addCandidate(candidates, "addelkempn", q, akn, 2 * qpow,
+                        2 * (qpow - 1) / (lq - 1) - 1, k, akn, q, rowLimit);
+                }
+            }
+
+            if (p == 2)
+            {
+                addCandidate(candidates, "bosebush", q, 0, 2 * lq * lq, 2 * lq + 1, k, 1, 2 * q, rowLimit);
+            }
+
+            // lambda is a power of the same prime, lambda = 2 for p = 2 is the bosebush design
+            for (long long lambda = p; lambda * lq * lq <= rowLimit; lambda *= p)
+            {
+                if (p == 2 && lambda == 2)
+                {
+                    continue;
+                }
+                addCandidate(candidates, "bosebushl", q, static_cast<int>(lambda), lambda * lq * lq,
+                    lambda * lq + 1, k, 1, static_cast<int>(lambda) * q, rowLimit);
+            }
+        }
+        return candidates;
+    }
+
+    OADesignPlan planOADesign(int n, int k, bool bChooseLargerDesign, bool bVerbose)
+    {
+        std::vector<OADesignPlan> candidates = enumerateOADesigns(n, k);
+        long long ln = static_cast<long long>(n);
+
+        if (bVerbose)
+        {
+            for (std::vector<OADesignPlan>::const_iterator it = candidates.begin(); it != candidates.end(); ++it) // LCOV_EXCL_START
+            {
+                PRINT_OUTPUT << "Candidate OA:  " << it->type << " with q=" << it->q << " param=" << it->param
+                    << " n=" << it->nrow << " k=" << it->ncol << " cost=" << it->cost << "\n";
+            } // LCOV_EXCL_STOP
+        }
+
+        int best = -1;
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            const OADesignPlan & c = candidates[i];
+            if (c.maxcol < k)
+            {
+                continue;
+            }
+            if (bChooseLargerDesign && c.nrow >= ln)
+            {
+                if (best < 0 || c.nrow < candidates[best].nrow ||
+                        (c.nrow == candidates[best].nrow && c.cost < candidates[best].cost))
+                {
+                    best = static_cast<int>(i);
+                }
+            }
+            else if (!bChooseLargerDesign && c.nrow <= ln)
+            {
+                if (best < 0 || c.nrow > candidates[best].nrow ||
+                        (c.nrow == candidates[best].nrow && c.cost < candidates[best].cost))
+                {
+                    best = static_cast<int>(i);
+                }
+            }
+        }
+
+        if (best < 0 && !bChooseLargerDesign)
+        {
+            // no small enough design has k columns, so take the most columns available
+            for (size_t i = 0; i < candidates.size(); i++)
+            {
+                const OADesignPlan & c = candidates[i];
+                if (c.nrow <= ln && (best < 0 || c.maxcol > candidates[best].maxcol ||
+                        (c.maxcol == candidates[best].maxcol && c.nrow > candidates[best].nrow) ||
+                        (c.maxcol == candidates[best].maxcol && c.nrow == candidates[best].nrow &&
+                        c.cost < candidates[best].cost)))
+                {
+                    best = static_cast<int>(i);
+                }
+            }
+        }
+
+        if (best < 0)
+        {
+            // every design is larger than n, so take the smallest design with k columns
+            return planOADesign(n, k, true, false);
+        }
+
+        if (bVerbose)
+        {
+            PRINT_OUTPUT << candidates[best].type << " selected\n"; // LCOV_EXCL_LINE
+        }
+        return candidates[best];
+    }
+
+    void buildOADesign(const OADesignPlan & plan, oacpp::COrthogonalArray & coa)
+    {
+        int nrow = 0;
+        if (plan.type == "addelkemp")
+        {
+            coa.addelkemp(plan.q, plan.ncol, &nrow);
+        }
+        else if (plan.type == "addelkemp3")
+        {
+            coa.addelkemp3(plan.q, plan.ncol, &nrow);
+        }
+        else if (plan.type == "addelkempn")
+        {
+            coa.addelkempn(plan.param, plan.q, plan.ncol, &nrow);
+        }
+        else if (plan.type == "bose")
+        {
+            coa.bose(plan.q, plan.ncol, &nrow);
+        }
+        else if (plan.type == "bosebush")
+        {
+            coa.bosebush(plan.q, plan.ncol, &nrow);
+        }
+        else if (plan.type == "bosebushl")
+        {
+            coa.bosebushl(plan.param, plan.q, plan.ncol, &nrow);
+        }
+        else if (plan.type == "busht")
+        {
+            coa.busht(plan.param, plan.q, plan.ncol, &nrow);
+        }
+        else
+        {
+            std::ostringstream msg; // LCOV_EXCL_START
+            msg << "Unknown orthogonal array construction: " << plan.type;
+            oacpp::ostringstream_runtime_error(msg); // LCOV_EXCL_STOP
+        }
+    }
+}
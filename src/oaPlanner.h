@@ -0,0 +1,89 @@
+/**
+ * @file oaPlanner.h
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License: <a href="http://www.gnu.org/licenses/gpl.html">GNU General Public License (GPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OAPLANNER_H
+#define	OAPLANNER_H
+
+#include "OACommonDefines.h"
+#include "primes.h"
+#include "COrthogonalArray.h"
+
+namespace oalhslib
+{
+    /**
+     * A candidate orthogonal array construction and its predicted size and cost
+     */
+    struct OADesignPlan
+    {
+        /** the construction: addelkemp, addelkemp3, addelkempn, bose, bosebush, bosebushl, or busht */
+        std::string type;
+        /** the number of levels in each column */
+        int q;
+        /** the strength for busht, lambda for bosebushl, the exponent for addelkempn, otherwise 0 */
+        int param;
+        /** the number of rows */
+        long long nrow;
+        /** the maximum number of columns available from the construction */
+        int maxcol;
+        /** the number of columns that will be constructed */
+        int ncol;
+        /** the predicted relative cost to construct the array and convert it to a Latin hypercube */
+        double cost;
+    };
+
+    /**
+     * Enumerate the orthogonal array constructions that could serve a request for n rows and k columns
+     *
+     * Every supported construction and every prime power q is considered up to
+     * the size of the smallest Bose design that meets the request.
+     *
+     * @param n the requested number of rows
+     * @param k the requested number of columns
+     * @return the candidate designs
+     */
+    std::vector<OADesignPlan> enumerateOADesigns(int n, int k);
+
+    /**
+     * Choose the orthogonal array construction for a request
+     *
+     * When <code>bChooseLargerDesign</code> is true, the design with the fewest
+     * rows that has at least <code>n</code> rows and <code>k</code> columns is
+     * chosen.  Otherwise the design with the most rows that has at most
+     * <code>n</code> rows and at least <code>k</code> columns is chosen, falling
+     * back to the most columns available when no design has <code>k</code>.
+     * Ties are broken by the predicted cost.
+     *
+     * @param n the requested number of rows
+     * @param k the requested number of columns
+     * @param bChooseLargerDesign choose a larger design if the orthogonal array is not sufficient
+     * @param bVerbose should messages be printed
+     * @return the chosen design
+     */
+    OADesignPlan planOADesign(int n, int k, bool bChooseLargerDesign, bool bVerbose);
+
+    /**
+     * Construct a planned orthogonal array
+     * @param plan the design plan
+     * @param coa the orthogonal array
+     */
+    void buildOADesign(const OADesignPlan & plan, oacpp::COrthogonalArray & coa);
+}
+
+#endif	/* OAPLANNER_H */
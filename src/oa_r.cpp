@@ -26,6 +26,12 @@ RcppExport SEXP /*int matrix*/ oa_type1(SEXP /*char*/ type, SEXP /*int*/ q,
   BEGIN_RCPP
     Rcpp::IntegerMatrix rcppA(1,1); // need to initialize
     oacpp::COrthogonalArray oa;
+    bclib::RunStatistics stats;
+    bool bStatistics = lhs_r::statisticsRequested();
+    if (bStatistics)
+    {
+        oa.setStatistics(&stats);
+    }
 
     if (TYPEOF(q) != INTSXP || TYPEOF(ncol) != INTSXP)
     {
@@ -92,7 +98,17 @@ RcppExport SEXP /*int matrix*/ oa_type1(SEXP /*char*/ type, SEXP /*int*/ q,
     oarutils::convertToIntegerMatrix<int>(oa.getoa(), rcppA);
     if (bRandomLocal)
     {
+        bclib::PhaseTimer randomizeTimer(bStatistics ? &stats : NULL, "randomize");
         oarutils::randomizeOA(rcppA, qlocal);
+        if (bStatistics)
+        {
+            stats.randomDraws += static_cast<bclib::RunStatistics::count_type>(rcppA.ncol()) *
+                static_cast<bclib::RunStatistics::count_type>(qlocal);
+        }
+    }
+    if (bStatistics)
+    {
+        lhs_r::setStatisticsAttribute(rcppA, stats);
     }
     return rcppA;
   END_RCPP
@@ -104,6 +120,12 @@ RcppExport SEXP /*int matrix*/ oa_type2(SEXP /*char*/ type, SEXP /*int*/ int1,
   BEGIN_RCPP
     Rcpp::IntegerMatrix rcppA(1,1); // need to initialize
     oacpp::COrthogonalArray oa;
+    bclib::RunStatistics stats;
+    bool bStatistics = lhs_r::statisticsRequested();
+    if (bStatistics)
+    {
+        oa.setStatistics(&stats);
+    }
 
     if (TYPEOF(q) != INTSXP || TYPEOF(ncol) != INTSXP ||
             TYPEOF(int1) != INTSXP)
@@ -188,7 +210,17 @@ RcppExport SEXP /*int matrix*/ oa_type2(SEXP /*char*/ type, SEXP /*int*/ int1,
     oarutils::convertToIntegerMatrix<int>(oa.getoa(), rcppA);
     if (bRandomLocal)
     {
+        bclib::PhaseTimer randomizeTimer(bStatistics ? &stats : NULL, "randomize");
         oarutils::randomizeOA(rcppA, qlocal);
+        if (bStatistics)
+        {
+            stats.randomDraws += static_cast<bclib::RunStatistics::count_type>(rcppA.ncol()) *
+                static_cast<bclib::RunStatistics::count_type>(qlocal);
+        }
+    }
+    if (bStatistics)
+    {
+        lhs_r::setStatisticsAttribute(rcppA, stats);
     }
     return rcppA;
   END_RCPP
@@ -199,7 +231,8 @@ RcppExport SEXP /*List*/ create_galois_field(SEXP /*int*/ q)
   BEGIN_RCPP
     int qlocal = Rcpp::as<int>(q);
 
-    oacpp::GaloisField gf = oacpp::GaloisField(qlocal);
+    std::shared_ptr<const oacpp::GaloisField> pgf = oacpp::GaloisFieldCache::getField(qlocal);
+    const oacpp::GaloisField & gf = *pgf;
 
     /** prime modulus exponent q = p^n --- Polynomial vector length */
     Rcpp::IntegerVector n = Rcpp::IntegerVector::create(gf.n);
@@ -217,10 +250,10 @@ RcppExport SEXP /*List*/ create_galois_field(SEXP /*int*/ q)
     Rcpp::IntegerVector root(gf.root.begin(), gf.root.end());
     /** sum field of dimension u_q x u_q*/
     Rcpp::IntegerMatrix plus(gf.q, gf.q);
-    oarutils::convertToIntegerMatrix<int>(gf.plus, plus);
+    oarutils::convertToIntegerMatrix<int>(gf.getPlusTable(), plus);
     /** product field of dimension u_q x u_q*/
     Rcpp::IntegerMatrix times(gf.q, gf.q);
-    oarutils::convertToIntegerMatrix<int>(gf.times, times);
+    oarutils::convertToIntegerMatrix<int>(gf.getTimesTable(), times);
     /** polynomial field of dimension u_q x u_n */
     Rcpp::IntegerMatrix poly(gf.q, gf.n);
     oarutils::convertToIntegerMatrix<int>(gf.poly, poly);
@@ -231,6 +264,36 @@ RcppExport SEXP /*List*/ create_galois_field(SEXP /*int*/ q)
   END_RCPP
 }
 
+RcppExport SEXP /*List*/ galois_field_cache_info()
+{
+  BEGIN_RCPP
+    std::vector<int> orders = oacpp::GaloisFieldCache::getCachedOrders();
+    return Rcpp::List::create(
+        Rcpp::Named("q") = Rcpp::IntegerVector(orders.begin(), orders.end()),
+        Rcpp::Named("bytes_used") = static_cast<double>(oacpp::GaloisFieldCache::getMemoryUsed()),
+        Rcpp::Named("bytes_limit") = static_cast<double>(oacpp::GaloisFieldCache::getMemoryLimit()),
+        Rcpp::Named("hits") = static_cast<double>(oacpp::GaloisFieldCache::getHits()),
+        Rcpp::Named("misses") = static_cast<double>(oacpp::GaloisFieldCache::getMisses()));
+  END_RCPP
+}
+
+RcppExport SEXP /*numeric*/ galois_field_cache_limit(SEXP /*numeric*/ bytes)
+{
+  BEGIN_RCPP
+    if (TYPEOF(bytes) != REALSXP || Rf_length(bytes) != 1)
+    {
+      Rcpp_error("bytes should be a single numeric value");
+    }
+    double bytes_local = Rcpp::as<double>(bytes);
+    if (!R_FINITE(bytes_local) || bytes_local < 0)
+    {
+      Rcpp_error("bytes should be a finite value >= 0");
+    }
+    double previous = static_cast<double>(oacpp::GaloisFieldCache::getMemoryLimit());
+    oacpp::GaloisFieldCache::setMemoryLimit(static_cast<size_t>(bytes_local));
+    return Rcpp::wrap(previous);
+  END_RCPP
+}
 
   /**
    * Multiplication in polynomial representation
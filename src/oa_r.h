@@ -27,6 +27,7 @@
 #include "COrthogonalArray.h"
 #include "matrix.h"
 #include "oa_r_utils.h"
+#include "lhs_r_utilities.h"
 
 /**
  * An entry point for a set of Orthogonal Array algorithms
@@ -66,6 +67,18 @@ RcppExport SEXP /*int matrix*/ oa_type2(SEXP /*char*/ type, SEXP /*int*/ int1, S
  * @return a List Galois field components
  */
 RcppExport SEXP /*List*/ create_galois_field(SEXP /*int*/ q);
+/**
+ * The state of the process-wide Galois field cache
+ * @return a List of the cached orders from the most to the least recently used,
+ * the bytes used, the bytes limit, and the number of hits and misses
+ */
+RcppExport SEXP /*List*/ galois_field_cache_info();
+/**
+ * Set the memory bound of the Galois field cache, releasing the least recently used fields over the bound
+ * @param bytes the bound in bytes
+ * @return the previous bound
+ */
+RcppExport SEXP /*numeric*/ galois_field_cache_limit(SEXP /*numeric*/ bytes);
 /**
  * Multiplication in polynomial representation
  *
@@ -37,8 +37,6 @@ RcppExport SEXP /*double matrix*/ oa_to_lhs(SEXP /*int*/ n, SEXP /*int*/ k,
 
     int nlocal = Rcpp::as<int>(n);
     int klocal = Rcpp::as<int>(k);
-    bclib::matrix<int>::size_type m_n = static_cast<bclib::matrix<int>::size_type>(nlocal);
-    bclib::matrix<int>::size_type m_k = static_cast<bclib::matrix<int>::size_type>(klocal);
     bool bverbose_local = Rcpp::as<bool>(bverbose);
 
     if (nlocal == NA_INTEGER || klocal == NA_INTEGER ||
@@ -47,17 +45,20 @@ RcppExport SEXP /*double matrix*/ oa_to_lhs(SEXP /*int*/ n, SEXP /*int*/ k,
       Rcpp_error("n, k, and bverbose are not permitted to be NA");
     }
 
-    bclib::matrix<int> oa_local = bclib::matrix<int>(m_n, m_k);
-    oarutils::convertToMatrix(intoa, oa_local);
-    bclib::matrix<int> intlhs_local = bclib::matrix<int>(m_n, m_k);
-    bclib::matrix<double> lhs_local = bclib::matrix<double>(m_n, m_k);
+    if (intoa.nrow() != nlocal || intoa.ncol() != klocal)
+    {
+      Rcpp_error("the size of the orthogonal array does not match the n and k parameters");
+    }
+
     lhs_r::RStandardUniform oRStandardUniform = lhs_r::RStandardUniform();
-    Rcpp::NumericMatrix rcppA(nlocal, klocal);
+    lhs_rng rng = {lhs_r::RStandardUniform::uniform, &oRStandardUniform};
+    Rcpp::NumericMatrix rcppA(Rcpp::no_init(nlocal, klocal));
+    lhs_r::StatisticsScope statistics;
 
-    oalhslib::oaLHS(nlocal, klocal, oa_local, intlhs_local, lhs_local,
-                    bverbose_local, oRStandardUniform);
+    lhs_r::checkStatus(lhs_oa_to_lhs(nlocal, klocal, intoa.begin(), bverbose_local,
+                                     &rng, rcppA.begin()));
+    statistics.setAttribute(rcppA);
 
-    oarutils::convertToRcppMatrix<double, Rcpp::NumericMatrix>(lhs_local, rcppA);
     return(rcppA);
 
   END_RCPP
@@ -80,8 +81,6 @@ RcppExport SEXP /*double matrix*/ create_oalhs(SEXP /*int*/ n, SEXP /*int*/ k,
 
     int nlocal = Rcpp::as<int>(n);
     int klocal = Rcpp::as<int>(k);
-    bclib::matrix<int>::size_type m_n = static_cast<bclib::matrix<int>::size_type>(nlocal);
-    bclib::matrix<int>::size_type m_k = static_cast<bclib::matrix<int>::size_type>(klocal);
     bool bverbose_local = Rcpp::as<bool>(bverbose);
     bool bChooseLargerDesign_local = Rcpp::as<bool>(bChooseLargerDesign);
 
@@ -92,14 +91,19 @@ RcppExport SEXP /*double matrix*/ create_oalhs(SEXP /*int*/ n, SEXP /*int*/ k,
       Rcpp_error("n, k, bChooseLargerDesign, and bverbose are not permitted to be NA");
     }
 
-    bclib::matrix<double> oalhs_local = bclib::matrix<double>(m_n, m_k);
-    Rcpp::NumericMatrix rcppA(nlocal, klocal);
+    // the design may be larger or smaller than requested, so its size is planned first
+    int nrows = 0;
+    int ncols = 0;
+    lhs_r::checkStatus(lhs_oalhs_size(nlocal, klocal, bChooseLargerDesign_local, &nrows, &ncols));
+    Rcpp::NumericMatrix rcppA(Rcpp::no_init(nrows, ncols));
     lhs_r::RStandardUniform oRStandardUniform = lhs_r::RStandardUniform();
+    lhs_rng rng = {lhs_r::RStandardUniform::uniform, &oRStandardUniform};
+    lhs_r::StatisticsScope statistics;
 
-    oalhslib::generateOALHS(nlocal, klocal, oalhs_local, bChooseLargerDesign_local,
-                            bverbose_local, oRStandardUniform);
+    lhs_r::checkStatus(lhs_create_oalhs(nlocal, klocal, bChooseLargerDesign_local, bverbose_local,
+                                        &rng, rcppA.begin(), static_cast<size_t>(rcppA.size())));
+    statistics.setAttribute(rcppA);
 
-    oarutils::convertToRcppMatrix<double, Rcpp::NumericMatrix>(oalhs_local, rcppA);
     return(rcppA);
   END_RCPP
 }
@@ -25,6 +25,7 @@
 #include "oa_r_utils.h"
 #include "oaLHS.h"
 #include "RStandardUniform.h"
+#include "lhs_r_utilities.h"
 
 /**
  * Create a Latin hypercube sample from an orthogonal array
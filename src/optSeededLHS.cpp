@@ -52,6 +52,12 @@ namespace lhslib
      */
     void optSeededLHS(int n, int k, int maxSweeps, double eps, bclib::matrix<double> & oldHypercube,
                       int optimalityRecordLength, bool bVerbose)
+    {
+        optSeededLHS(n, k, maxSweeps, eps, oldHypercube, optimalityRecordLength, bVerbose, NULL);
+    }
+
+    void optSeededLHS(int n, int k, int maxSweeps, double eps, bclib::matrix<double> & oldHypercube,
+                      int optimalityRecordLength, bool bVerbose, bclib::RunStatistics * stats)
     {
         if (n < 1 || k < 1 || maxSweeps < 1 || eps <= 0)
         {
@@ -70,8 +76,8 @@ namespace lhslib
         int test;
         unsigned int iter, posit, optimalityRecordIndex;
 
+        bclib::PhaseTimer initializeTimer(stats, "initialize");
         //matrix_unsafe<double> oldHypercube_new = matrix_unsafe<double>(nsamples, nparameters, oldHypercube, true);
-        bclib::matrix<double> newHypercube = bclib::matrix<double>(nsamples, nparameters);
         std::vector<double> optimalityRecord = std::vector<double>(nOptimalityRecordLength);
         std::vector<unsigned int> interchangeRow1 = std::vector<unsigned int>(nOptimalityRecordLength);
         std::vector<unsigned int> interchangeRow2 = std::vector<unsigned int>(nOptimalityRecordLength);
@@ -79,6 +85,16 @@ namespace lhslib
         /* find the initial optimality measure */
         gOptimalityOld = sumInvDistance<double>(oldHypercube);
 
+        if (stats != NULL)
+        {
+            stats->criterionEvaluations++;
+            stats->addAllocation<double>(nOptimalityRecordLength);
+            stats->addAllocation<unsigned int>(2 * static_cast<size_t>(nOptimalityRecordLength));
+            stats->criterionTrajectory.push_back(gOptimalityOld);
+        }
+        initializeTimer.stop();
+        bclib::PhaseTimer optimizeTimer(stats, "optimize");
+
         if (bVerbose)
         {
             PRINT_MACRO << "Beginning Optimality Criterion " << gOptimalityOld << " \n"; // LCOV_EXCL_LINE
@@ -108,20 +124,19 @@ namespace lhslib
                     /* iterate over the rows for the second point from i+1 to N-1 */
                     for (msize_type kindex = i + 1; kindex < nsamples; kindex++)
                     {
-                        /* put the values from oldHypercube into newHypercube */
-                        copyMatrix<double>(newHypercube, oldHypercube);
-                        
                         /* exchange two values (from the ith and kth rows) in the jth column
-                        * and place them in the new matrix */
-                        newHypercube(i, j) = oldHypercube(kindex, j);
-                        newHypercube(kindex, j) = oldHypercube(i, j);
+                        * in place rather than in a copy of the hypercube */
+                        std::swap(oldHypercube(i, j), oldHypercube(kindex, j));
 
                         /* store the optimality of the newly created matrix and the rows that
                         * were interchanged */
-                        optimalityRecord[optimalityRecordIndex] = sumInvDistance<double>(newHypercube);
+                        optimalityRecord[optimalityRecordIndex] = sumInvDistance<double>(oldHypercube);
                         interchangeRow1[optimalityRecordIndex] = static_cast<unsigned int>(i);
                         interchangeRow2[optimalityRecordIndex] = static_cast<unsigned int>(kindex);
                         optimalityRecordIndex++;
+
+                        /* restore the hypercube */
+                        std::swap(oldHypercube(i, j), oldHypercube(kindex, j));
                     }
                 }
                 /* once all combinations of the row interchanges have been completed for
@@ -130,6 +145,11 @@ namespace lhslib
                 optimalityRecord[optimalityRecordIndex] = gOptimalityOld;
                 interchangeRow1[optimalityRecordIndex] = 0;
                 interchangeRow2[optimalityRecordIndex] = 0;
+                if (stats != NULL)
+                {
+                    stats->criterionEvaluations += optimalityRecordIndex;
+                    stats->candidatesScored += optimalityRecordIndex;
+                }
 
                 /* Find which optimality measure is the lowest for the current column.
                 * In other words, which two row interchanges made the hypercube better in
@@ -146,15 +166,8 @@ namespace lhslib
                 /* If the new minimum optimality measure is better than the old measure */
                 if (optimalityRecord[posit] < gOptimalityOld)
                 {
-                    /* put oldHypercube in newHypercube */
-                    copyMatrix<double>(newHypercube, oldHypercube);
-                    
                     /* Interchange the rows that were the best for this column */
-                    newHypercube(interchangeRow1[posit], j) = oldHypercube(interchangeRow2[posit], j);
-                    newHypercube(interchangeRow2[posit], j) = oldHypercube(interchangeRow1[posit], j);
-
-                    /* put newHypercube back in oldHypercube for the next iteration */
-                    copyMatrix<double>(oldHypercube, newHypercube);
+                    std::swap(oldHypercube(interchangeRow1[posit], j), oldHypercube(interchangeRow2[posit], j));
 
                     /* if this is not the first column we have used for this sweep */
                     if (j > 0)
@@ -178,6 +191,10 @@ namespace lhslib
 
                     /* replace the old optimality measure with the current one */
                     gOptimalityOld = optimalityRecord[posit];
+                    if (stats != NULL)
+                    {
+                        stats->acceptedMoves++;
+                    }
                 }
                 /* if the new and old optimality measures are equal */
                 else if (optimalityRecord[posit] == gOptimalityOld)
@@ -194,6 +211,10 @@ namespace lhslib
                     ERROR_MACRO << "Unexpected Result: Algorithm produced a less optimal design\n";
                     test = 1;
                 } // LCOV_EXCL_STOP
+                if (stats != NULL)
+                {
+                    stats->criterionTrajectory.push_back(gOptimalityOld);
+                }
                 /* if there is a reason to exit... */
                 if (test == 1)
                 {
@@ -203,6 +224,8 @@ namespace lhslib
             }
         }
 
+        optimizeTimer.stop();
+
         /* if we made it through all the sweeps */
         if (iter == nMaxSweeps)
         {
@@ -48,6 +48,13 @@ namespace lhslib
  */
     void optimumLHS(int n, int k, int maxSweeps, double eps, bclib::matrix<int> & outlhs,
                     int optimalityRecordLength, bclib::CRandom<double> & oRandom, bool bVerbose)
+    {
+        optimumLHS(n, k, maxSweeps, eps, outlhs, optimalityRecordLength, oRandom, bVerbose, NULL);
+    }
+
+    void optimumLHS(int n, int k, int maxSweeps, double eps, bclib::matrix<int> & outlhs,
+                    int optimalityRecordLength, bclib::CRandom<double> & oRandom, bool bVerbose,
+                    bclib::RunStatistics * stats)
     {
         if (n < 1 || k < 1 || maxSweeps < 1 || eps <= 0)
         {
@@ -66,12 +73,20 @@ namespace lhslib
         int test;
         unsigned int iter, posit, optimalityRecordIndex;
 
+        bclib::PhaseTimer initializeTimer(stats, "initialize");
+        bclib::CountingRandom countedRandom(oRandom);
+        // draw through the counter only when the statistics are requested
+        bclib::CRandom<double> & drawRandom = (stats != NULL) ?
+            static_cast<bclib::CRandom<double> &>(countedRandom) : oRandom;
         if (outlhs.rowsize() != nsamples || outlhs.colsize() != nparameters)
         {
             outlhs = bclib::matrix<int>(nsamples, nparameters);
+            if (stats != NULL)
+            {
+                stats->addAllocation<int>(nsamples * nparameters);
+            }
         }
         //matrix_unsafe<int> oldHypercube_new = matrix_unsafe<int>(nsamples, nparameters, oldHypercube, true);
-        bclib::matrix<int> newHypercube = bclib::matrix<int>(nsamples, nparameters);
         std::vector<double> optimalityRecord = std::vector<double>(nOptimalityRecordLength);
         std::vector<unsigned int> interchangeRow1 = std::vector<unsigned int>(nOptimalityRecordLength);
         std::vector<unsigned int> interchangeRow2 = std::vector<unsigned int>(nOptimalityRecordLength);
@@ -84,7 +99,7 @@ namespace lhslib
             // fill a vector with a random sample to order
             for (msize_type irow = 0; irow < nsamples; irow++)
             {
-                randomUnif[irow] = oRandom.getNextRandom();
+                randomUnif[irow] = drawRandom.getNextRandom();
             }
             bclib::findorder<double>(randomUnif, orderedUnif);
             for (msize_type irow = 0; irow < nsamples; irow++)
@@ -93,8 +108,23 @@ namespace lhslib
             }
         }
         
+        /* the inverse distance of every integer squared distance in the hypercube */
+        InverseDistanceTable invDistance(n, k);
+
         /* find the initial optimality measure */
-        gOptimalityOld = sumInvDistance<int>(outlhs);
+        gOptimalityOld = sumInvDistance(outlhs, invDistance);
+
+        if (stats != NULL)
+        {
+            stats->criterionEvaluations++;
+            stats->randomDraws += countedRandom.draws();
+            stats->addAllocation<double>(nOptimalityRecordLength + nsamples + invDistance.size());
+            stats->addAllocation<unsigned int>(2 * static_cast<size_t>(nOptimalityRecordLength));
+            stats->addAllocation<int>(nsamples);
+            stats->criterionTrajectory.push_back(gOptimalityOld);
+        }
+        initializeTimer.stop();
+        bclib::PhaseTimer optimizeTimer(stats, "optimize");
 
         if (bVerbose)
         {
@@ -125,20 +155,19 @@ namespace lhslib
                     /* iterate over the rows for the second point from i+1 to N-1 */
                     for (msize_type kindex = (i + 1); kindex < nsamples; kindex++)
                     {
-                        /* put the values from oldHypercube into newHypercube */
-                        copyMatrix<int>(newHypercube, outlhs);
-
                         /* exchange two values (from the ith and kth rows) in the jth column
-                        * and place them in the new matrix */
-                        newHypercube(i, j) = outlhs(kindex, j);
-                        newHypercube(kindex, j) = outlhs(i, j);
+                        * in place rather than in a copy of the hypercube */
+                        std::swap(outlhs(i, j), outlhs(kindex, j));
 
                         /* store the optimality of the newly created matrix and the rows that
                         * were interchanged */
-                        optimalityRecord[optimalityRecordIndex] = sumInvDistance<int>(newHypercube);
+                        optimalityRecord[optimalityRecordIndex] = sumInvDistance(outlhs, invDistance);
                         interchangeRow1[optimalityRecordIndex] = static_cast<unsigned int>(i);
                         interchangeRow2[optimalityRecordIndex] = static_cast<unsigned int>(kindex);
                         optimalityRecordIndex++;
+
+                        /* restore the hypercube */
+                        std::swap(outlhs(i, j), outlhs(kindex, j));
                     }
                 }
                 /* once all combinations of the row interchanges have been completed for
@@ -147,6 +176,11 @@ namespace lhslib
                 optimalityRecord[optimalityRecordIndex] = gOptimalityOld;
                 interchangeRow1[optimalityRecordIndex] = 0;
                 interchangeRow2[optimalityRecordIndex] = 0;
+                if (stats != NULL)
+                {
+                    stats->criterionEvaluations += optimalityRecordIndex;
+                    stats->candidatesScored += optimalityRecordIndex;
+                }
 
                 /* Find which optimality measure is the lowest for the current column.
                 * In other words, which two row interchanges made the hypercube better in
@@ -163,15 +197,8 @@ namespace lhslib
                 /* If the new minimum optimality measure is better than the old measure */
                 if (optimalityRecord[posit] < gOptimalityOld)
                 {
-                    /* put oldHypercube in newHypercube */
-                    copyMatrix(newHypercube, outlhs);
-
                     /* Interchange the rows that were the best for this column */
-                    newHypercube(interchangeRow1[posit], j) = outlhs(interchangeRow2[posit], j);
-                    newHypercube(interchangeRow2[posit], j) = outlhs(interchangeRow1[posit], j);
-
-                    /* put newHypercube back in oldHypercube for the next iteration */
-                    copyMatrix(outlhs, newHypercube);
+                    std::swap(outlhs(interchangeRow1[posit], j), outlhs(interchangeRow2[posit], j));
 
                     /* if this is not the first column we have used for this sweep */
                     if (j > 0)
@@ -195,6 +222,10 @@ namespace lhslib
 
                     /* replace the old optimality measure with the current one */
                     gOptimalityOld = optimalityRecord[posit];
+                    if (stats != NULL)
+                    {
+                        stats->acceptedMoves++;
+                    }
                 }
                 /* if the new and old optimality measures are equal */
                 else if (optimalityRecord[posit] == gOptimalityOld)
@@ -211,6 +242,10 @@ namespace lhslib
                     ERROR_MACRO << "Unexpected Result: Algorithm produced a less optimal design\n";
                     test = 1;
                 } // LCOV_EXCL_STOP
+                if (stats != NULL)
+                {
+                    stats->criterionTrajectory.push_back(gOptimalityOld);
+                }
                 /* if there is a reason to exit... */
                 if (test == 1) 
                 {
@@ -220,6 +255,8 @@ namespace lhslib
             }
         }
 
+        optimizeTimer.stop();
+
         /* if we made it through all the sweeps */
         if (iter == nMaxSweeps)
         {
@@ -0,0 +1,261 @@
+/**
+ * @file parallelFor.h
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * @license <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PARALLELFOR_H
+#define	PARALLELFOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <algorithm>
+
+/**
+ * The environment variable that limits the number of threads of the libraries
+ */
+#define BCLIB_NUM_THREADS_ENV "LHS_NUM_THREADS"
+
+/**
+ * The default thread limit of the R package.  CRAN and shared R hosts expect
+ * at most 2 threads unless the user asks for more.
+ */
+#define BCLIB_R_DEFAULT_THREADS 2
+
+namespace bclib
+{
+    /**
+     * The thread limit set with <code>setMaxThreads</code>
+     * @return a reference to the limit, 0 if none is set
+     */
+    inline std::atomic<unsigned int> & threadLimit()
+    {
+        // function local statics are initialized once in a thread-safe way
+        static std::atomic<unsigned int> limit(0);
+        return limit;
+    }
+
+    /**
+     * Limit the number of threads used by the parallel algorithms
+     * @param nthreads the maximum number of threads, or 0 to restore the default
+     */
+    inline void setMaxThreads(unsigned int nthreads)
+    {
+        threadLimit() = nthreads;
+    }
+
+    /**
+     * The maximum number of threads used by the parallel algorithms
+     *
+     * The limit set with <code>setMaxThreads</code> if there is one, otherwise
+     * the positive integer in the <code>LHS_NUM_THREADS</code> environment
+     * variable, otherwise the number of processors.  The R package uses at
+     * most <code>BCLIB_R_DEFAULT_THREADS</code> by default.
+     *
+     * @return the number of threads, at least 1
+     */
+    inline unsigned int getMaxThreads()
+    {
+        unsigned int limit = threadLimit();
+        if (limit > 0)
+        {
+            return limit;
+        }
+        const char * env = std::getenv(BCLIB_NUM_THREADS_ENV);
+        if (env != NULL)
+        {
+            long envLimit = std::strtol(env, NULL, 10);
+            if (envLimit > 0)
+            {
+                return static_cast<unsigned int>(envLimit);
+            }
+        }
+        unsigned int processors = std::max<unsigned int>(1, std::thread::hardware_concurrency());
+#ifdef RCOMPILE
+        return std::min<unsigned int>(BCLIB_R_DEFAULT_THREADS, processors);
+#else
+        return processors;
+#endif
+    }
+
+    /**
+     * The number of threads for an amount of work
+     * @param work the amount of work, for example rows or tiles
+     * @param minWorkPerThread the least work that is worth a thread
+     * @return the number of threads on <code>[1, getMaxThreads()]</code>
+     */
+    inline unsigned int threadsForWork(size_t work, size_t minWorkPerThread)
+    {
+        size_t wanted = work / std::max<size_t>(1, minWorkPerThread);
+        if (wanted <= 1)
+        {
+            return 1;
+        }
+        return static_cast<unsigned int>(std::min<size_t>(wanted, getMaxThreads()));
+    }
+
+    /**
+     * Join the workers and rethrow the first exception of a worker
+     * @param workers the threads
+     * @param errors the exception of each thread, empty if it finished
+     */
+    inline void joinWorkers(std::vector<std::thread> & workers, std::vector<std::exception_ptr> & errors)
+    {
+        for (size_t t = 0; t < workers.size(); t++)
+        {
+            workers[t].join();
+        }
+        for (size_t t = 0; t < errors.size(); t++)
+        {
+            if (errors[t])
+            {
+                std::rethrow_exception(errors[t]); // LCOV_EXCL_LINE
+            }
+        }
+    }
+
+    /**
+     * Run a function over contiguous ranges of <code>[0, count)</code>, one range per thread
+     *
+     * The ranges differ in length by at most one.  With one thread the function
+     * is called on the calling thread.  Ranges whose thread cannot be started,
+     * for example at a process thread limit, are run on the calling thread.  An
+     * exception in any range is rethrown after every thread has finished.
+     *
+     * @param count the number of items
+     * @param nthreads the number of threads, clamped to <code>[1, count]</code>
+     * @param f called as <code>f(first, last)</code> for each range of items <code>[first, last)</code>
+     * @tparam F a function object
+     */
+    template <class F>
+    void parallelForRange(size_t count, unsigned int nthreads, F f)
+    {
+        size_t u_nthreads = std::max<size_t>(1, std::min<size_t>(nthreads, count));
+        if (u_nthreads == 1)
+        {
+            f(static_cast<size_t>(0), count);
+            return;
+        }
+        std::vector<std::thread> workers;
+        workers.reserve(u_nthreads);
+        std::vector<std::exception_ptr> errors(u_nthreads);
+        size_t chunk = count / u_nthreads;
+        size_t extra = count % u_nthreads;
+        size_t first = 0;
+        bool bSpawn = true;
+        for (size_t t = 0; t < u_nthreads; t++)
+        {
+            size_t last = first + chunk + ((t < extra) ? 1 : 0);
+            auto work = [&f, &errors, t, first, last]()
+            {
+                try
+                {
+                    f(first, last);
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception(); // LCOV_EXCL_LINE
+                }
+            };
+            if (bSpawn)
+            {
+                try
+                {
+                    workers.push_back(std::thread(work));
+                }
+                catch (std::system_error &)
+                {
+                    // the started workers are joined below, the rest run here
+                    bSpawn = false; // LCOV_EXCL_LINE
+                }
+            }
+            if (!bSpawn)
+            {
+                work(); // LCOV_EXCL_LINE
+            }
+            first = last;
+        }
+        joinWorkers(workers, errors);
+    }
+
+    /**
+     * Run a function on each item of <code>[0, count)</code>, with the threads
+     * taking the next item as they finish
+     *
+     * Use when the items have very different costs.  With one thread the items
+     * are run in order on the calling thread.  If a thread cannot be started,
+     * the calling thread takes items with the threads that did start.  An
+     * exception in any item is rethrown after every thread has finished.
+     *
+     * @param count the number of items
+     * @param nthreads the number of threads, clamped to <code>[1, count]</code>
+     * @param f called as <code>f(item)</code> for each item
+     * @tparam F a function object
+     */
+    template <class F>
+    void parallelForEach(size_t count, unsigned int nthreads, F f)
+    {
+        size_t u_nthreads = std::max<size_t>(1, std::min<size_t>(nthreads, count));
+        if (u_nthreads == 1)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                f(i);
+            }
+            return;
+        }
+        std::atomic<size_t> next(0);
+        std::vector<std::thread> workers;
+        workers.reserve(u_nthreads);
+        std::vector<std::exception_ptr> errors(u_nthreads);
+        for (size_t t = 0; t < u_nthreads; t++)
+        {
+            auto work = [&f, &next, &errors, count, t]()
+            {
+                try
+                {
+                    for (size_t i = next++; i < count; i = next++)
+                    {
+                        f(i);
+                    }
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception(); // LCOV_EXCL_LINE
+                }
+            };
+            try
+            {
+                workers.push_back(std::thread(work));
+            }
+            catch (std::system_error &)
+            {
+                // take the remaining items here, then join the started workers
+                work(); // LCOV_EXCL_LINE
+                break; // LCOV_EXCL_LINE
+            }
+        }
+        joinWorkers(workers, errors);
+    }
+} // end namespace
+
+#endif	/* PARALLELFOR_H */
@@ -29,11 +29,118 @@
  */
 
 #include "primes.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
 
 namespace oacpp
 {
     namespace primes
     {
+        /**
+         * Table of the prime base and exponent of every integer up to a bound
+         */
+        struct PrimePowerTable
+        {
+            /** the largest integer in the table */
+            int bound;
+            /** the prime p where i = p^n, or 0 if i is not a prime power */
+            std::vector<int> base;
+            /** the exponent n where i = p^n */
+            std::vector<unsigned char> exponent;
+        };
+
+        /**
+         * Shared state of the prime power sieve
+         */
+        struct SieveState
+        {
+            /** protects building the table and the bound */
+            std::mutex lock;
+            /** the current table, read without the lock */
+            std::atomic<const PrimePowerTable*> current;
+            /** every table built, kept alive for readers that still hold an older table */
+            std::vector<std::unique_ptr<PrimePowerTable> > tables;
+            /** the bound of the next table */
+            int bound;
+
+            SieveState() : current(nullptr), bound(PRIMES_SIEVE_DEFAULT_BOUND) {}
+        };
+
+        static SieveState & sieveState()
+        {
+            // function local statics are initialized once in a thread-safe way
+            static SieveState state;
+            return state;
+        }
+
+        static const PrimePowerTable & sieveTable()
+        {
+            SieveState & state = sieveState();
+            const PrimePowerTable * table = state.current.load(std::memory_order_acquire);
+            if (table != nullptr)
+            {
+                return *table;
+            }
+
+            std::lock_guard<std::mutex> guard(state.lock);
+            table = state.current.load(std::memory_order_acquire);
+            if (table != nullptr)
+            {
+                return *table; // LCOV_EXCL_LINE
+            }
+            std::unique_ptr<PrimePowerTable> newTable(new PrimePowerTable());
+            size_t ubound = static_cast<size_t>(state.bound);
+            newTable->bound = state.bound;
+            newTable->base.assign(ubound + 1, 0);
+            newTable->exponent.assign(ubound + 1, 0);
+            std::vector<bool> composite(ubound + 1, false);
+            for (size_t p = 2; p <= ubound; p++)
+            {
+                if (composite[p])
+                {
+                    continue;
+                }
+                for (size_t m = p * p; m <= ubound; m += p)
+                {
+                    composite[m] = true;
+                }
+                unsigned char n = 1;
+                for (size_t pn = p; pn <= ubound; pn *= p, n++)
+                {
+                    newTable->base[pn] = static_cast<int>(p);
+                    newTable->exponent[pn] = n;
+                    if (pn > ubound / p)
+                    {
+                        break;
+                    }
+                }
+            }
+            table = newTable.get();
+            state.tables.push_back(std::move(newTable));
+            state.current.store(table, std::memory_order_release);
+            return *table;
+        }
+
+        void setSieveBound(int bound)
+        {
+            if (bound < 2)
+            {
+                throw std::runtime_error("The prime power sieve bound must be at least 2");
+            }
+            SieveState & state = sieveState();
+            std::lock_guard<std::mutex> guard(state.lock);
+            state.bound = bound;
+            state.current.store(nullptr, std::memory_order_release);
+        }
+
+        int getSieveBound()
+        {
+            SieveState & state = sieveState();
+            std::lock_guard<std::mutex> guard(state.lock);
+            return state.bound;
+        }
+
         int isprime_old(int p) // LCOV_EXCL_START
         {
             if (p < 2)
@@ -63,6 +170,11 @@ namespace oacpp
             {
                 return ISPRIMEFALSE;
             }
+            const PrimePowerTable & table = sieveTable();
+            if (n <= static_cast<unsigned int>(table.bound))
+            {
+                return (table.exponent[n] == 1) ? ISPRIMETRUE : ISPRIMEFALSE;
+            }
             // 2, 3
             if (n < 4)
             {
@@ -99,6 +211,19 @@ namespace oacpp
                 return;
             }
 
+            const PrimePowerTable & table = sieveTable();
+            if (q <= table.bound)
+            {
+                size_t uq = static_cast<size_t>(q);
+                if (table.base[uq] != 0)
+                {
+                    *p = table.base[uq];
+                    *n = table.exponent[uq];
+                    *isit = 1;
+                }
+                return;
+            }
+
             if (isprime(q) != 0)
             {
                 *p = q;
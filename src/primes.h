@@ -41,6 +41,10 @@
  * Macro to indicate that a number is not prime
  */
 #define ISPRIMEFALSE 0
+/**
+ * The default largest integer held in the prime power sieve
+ */
+#define PRIMES_SIEVE_DEFAULT_BOUND 65536
 
 namespace oacpp {
     /**
@@ -65,6 +69,10 @@ namespace oacpp {
         
         /**
          * find q=p^n if q is a prime power with n>0
+         *
+         * Values of q up to the sieve bound are looked up in constant time in a
+         * table built on first use.  Larger values are factored by trial division.
+         *
          * @param q integer that is a prime power
          * @param p the prime base
          * @param n the integer power
@@ -78,6 +86,20 @@ namespace oacpp {
          * @return 
          */
 		int isprimepow(int q );
+
+        /**
+         * Set the largest integer held in the prime power sieve
+         * @note the sieve is rebuilt on the next lookup.  Each entry uses five bytes
+         * @param bound the largest integer in the sieve
+         * @throws std::runtime_error if the bound is less than 2
+         */
+        void setSieveBound(int bound);
+
+        /**
+         * Get the largest integer held in the prime power sieve
+         * @return the sieve bound
+         */
+        int getSieveBound();
         
         /**
          * pow() with integer arguments and value
@@ -0,0 +1,574 @@
+/**
+ * @file simdDistance.cpp
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "simdDistance.h"
+#include <atomic>
+
+/*
+ * The kernels for each instruction set are compiled with target attributes so
+ * that the package can be built with the default compiler flags and still use
+ * the widest registers of the processor it runs on.  Other compilers and
+ * processors use the portable kernels, which compilers can auto-vectorize.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LHS_SIMD_X86
+/*
+ * The portable kernel is never inlined into a kernel with a target attribute,
+ * which would let the compiler fuse its multiplies and adds
+ */
+#define LHS_NOINLINE __attribute__((noinline))
+#include <immintrin.h>
+#define LHS_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define LHS_TARGET_AVX2 __attribute__((target("avx2")))
+#define LHS_TARGET_AVX512 __attribute__((target("avx512f")))
+#define LHS_TARGET_AVX512BW __attribute__((target("avx512f,avx512bw")))
+/*
+ * Unroll the loop over the coordinates.  With the number of coordinates fixed
+ * at compile time the loop disappears and the broadcast coordinates of the
+ * point stay in registers across the whole block.
+ */
+#if defined(__clang__)
+#define LHS_UNROLL_K _Pragma("unroll 16")
+#elif __GNUC__ >= 8
+#define LHS_UNROLL_K _Pragma("GCC unroll 16")
+#else
+#define LHS_UNROLL_K
+#endif
+#else
+#define LHS_NOINLINE
+#endif
+
+namespace lhslib
+{
+    /**
+     * The portable kernel for the points from <code>first</code> to <code>nblock</code>,
+     * also used for the points left over after the last full SIMD register
+     * @param point the coordinates of the point
+     * @param block the first coordinate of the first point in the block
+     * @param first the first point to calculate
+     * @param nblock the number of points in the block
+     * @param k the number of coordinates
+     * @param ld the distance between coordinates of a point in the block
+     * @param out the squared distances
+     * @tparam T the type of the coordinates
+     * @tparam S the type of the squared distances
+     */
+    template <class T, class S>
+    LHS_NOINLINE static void distanceSquaredScalar(const T * point, const T * block, size_t first, size_t nblock,
+        size_t k, size_t ld, S * out)
+    {
+        for (size_t j = first; j < nblock; j++)
+        {
+            out[j] = static_cast<S>(0);
+        }
+        for (size_t c = 0; c < k; c++)
+        {
+            const T * column = block + c * ld;
+            S pc = static_cast<S>(point[c]);
+            for (size_t j = first; j < nblock; j++)
+            {
+                S diff = static_cast<S>(column[j]) - pc;
+                out[j] += diff * diff;
+            }
+        }
+    }
+
+#ifdef LHS_SIMD_X86
+    /*
+     * Each kernel holds the running sums of one register of points and adds the
+     * squared difference of one coordinate at a time.  Multiplies and adds are
+     * separate instructions, never fused, so the double sums round exactly as
+     * the portable loop does when the package is built without -mfma.
+     * K is the number of coordinates when it is fixed at compile time, or 0 to
+     * use the run time <code>k</code>.
+     *
+     * The 16 bit kernels subtract in 16 bits, so a register holds twice as many
+     * points, and interleave each difference with a zero so that the multiply-add
+     * of pairs gives its square in 32 bits.
+     */
+
+    template <size_t K>
+    LHS_TARGET_SSE41
+    static void distanceSquaredSSE41(const int32_t * point, const int32_t * block, size_t nblock,
+        size_t k, size_t ld, uint32_t * out)
+    {
+        const size_t nk = (K > 0) ? K : k;
+        size_t j = 0;
+        for (; j + 4 <= nblock; j += 4)
+        {
+            __m128i sum = _mm_setzero_si128();
+            LHS_UNROLL_K
+            for (size_t c = 0; c < nk; c++)
+            {
+                __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + c * ld + j));
+                __m128i diff = _mm_sub_epi32(x, _mm_set1_epi32(point[c]));
+                sum = _mm_add_epi32(sum, _mm_mullo_epi32(diff, diff));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + j), sum);
+        }
+        distanceSquaredScalar<int32_t, uint32_t>(point, block, j, nblock, k, ld, out);
+    }
+
+    template <size_t K>
+    LHS_TARGET_SSE41
+    static void distanceSquaredSSE41(const int16_t * point, const int16_t * block, size_t nblock,
+        size_t k, size_t ld, uint32_t * out)
+    {
+        const size_t nk = (K > 0) ? K : k;
+        const __m128i zero = _mm_setzero_si128();
+        size_t j = 0;
+        for (; j + 8 <= nblock; j += 8)
+        {
+            __m128i sumLo = _mm_setzero_si128();
+            __m128i sumHi = _mm_setzero_si128();
+            LHS_UNROLL_K
+            for (size_t c = 0; c < nk; c++)
+            {
+                __m128i diff = _mm_sub_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(block + c * ld + j)),
+                    _mm_set1_epi16(point[c]));
+                __m128i lo = _mm_unpacklo_epi16(diff, zero);
+                __m128i hi = _mm_unpackhi_epi16(diff, zero);
+                sumLo = _mm_add_epi32(sumLo, _mm_madd_epi16(lo, lo));
+                sumHi = _mm_add_epi32(sumHi, _mm_madd_epi16(hi, hi));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + j), sumLo);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + j + 4), sumHi);
+        }
+        distanceSquaredScalar<int16_t, uint32_t>(point, block, j, nblock, k, ld, out);
+    }
+
+    template <size_t K>
+    LHS_TARGET_SSE41
+    static void distanceSquaredSSE41(const double * point, const double * block, size_t nblock,
+        size_t k, size_t ld, double * out)
+    {
+        const size_t nk = (K > 0) ? K : k;
+        size_t j = 0;
+        for (; j + 2 <= nblock; j += 2)
+        {
+            __m128d sum = _mm_setzero_pd();
+            LHS_UNROLL_K
+            for (size_t c = 0; c < nk; c++)
+            {
+                __m128d diff = _mm_sub_pd(_mm_loadu_pd(block + c * ld + j), _mm_set1_pd(point[c]));
+                sum = _mm_add_pd(sum, _mm_mul_pd(diff, diff));
+            }
+            _mm_storeu_pd(out + j, sum);
+        }
+        distanceSquaredScalar<double, double>(point, block, j, nblock, k, ld, out);
+    }
+
+    template <size_t K>
+    LHS_TARGET_AVX2
+    static void distanceSquaredAVX2(const int32_t * point, const int32_t * block, size_t nblock,
+        size_t k, size_t ld, uint32_t * out)
+    {
+        const size_t nk = (K > 0) ? K : k;
+        size_t j = 0;
+        for (; j + 8 <= nblock; j += 8)
+        {
+            __m256i sum = _mm256_setzero_si256();
+            LHS_UNROLL_K
+            for (size_t c = 0; c < nk; c++)
+            {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + c * ld + j));
+                __m256i diff = _mm256_sub_epi32(x, _mm256_set1_epi32(point[c]));
+                sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(diff, diff));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + j), sum);
+        }
+        distanceSquaredScalar<int32_t, uint32_t>(point, block, j, nblock, k, ld, out);
+    }
+
+    template <size_t K>
+    LHS_TARGET_AVX2
+    static void distanceSquaredAVX2(const int16_t * point, const int16_t * block, size_t nblock,
+        size_t k, size_t ld, uint32_t * out)
+    {
+        const size_t nk = (K > 0) ? K : k;
+        const __m256i zero = _mm256_setzero_si256();
+        size_t j = 0;
+        for (; j + 16 <= nblock; j += 16)
+        {
+            __m256i sumLo = _mm256_setzero_si256();
+            __m256i sumHi = _mm256_setzero_si256();
+            LHS_UNROLL_K
+            for (size_t c = 0; c < nk; c++)
+            {
+                __m256i diff = _mm256_sub_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + c * ld + j)),
+                    _mm256_set1_epi16(point[c]));
+                __m256i lo = _mm256_unpacklo_epi16(diff, zero);
+                __m256i hi = _mm256_unpackhi_epi16(diff, zero);
+                sumLo = _mm256_add_epi32(sumLo, _mm256_madd_epi16(lo, lo));
+                sumHi = _mm256_add_epi32(sumHi, _mm256_madd_epi16(hi, hi));
+            }
+            // the unpacks work within 128 bit lanes, so sumLo holds points 0-3 and 8-11
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + j), _mm256_permute2x128_si256(sumLo, sumHi, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + j + 8), _mm256_permute2x128_si256(sumLo, sumHi, 0x31));
+        }
+        distanceSquaredSSE41<K>(point, block + j, nblock - j, k, ld, out + j);
+    }
+
+    template <size_t K>
+    LHS_TARGET_AVX2
+    static void distanceSquaredAVX2(const double * point, const double * block, size_t nblock,
+        size_t k, size_t ld, double * out)
+    {
+        const size_t nk = (K > 0) ? K : k;
+        size_t j = 0;
+        for (; j + 4 <= nblock; j += 4)
+        {
+            __m256d sum = _mm256_setzero_pd();
+            LHS_UNROLL_K
+            for (size_t c = 0; c < nk; c++)
+            {
+                __m256d diff = _mm256_sub_pd(_mm256_loadu_pd(block + c * ld + j), _mm256_set1_pd(point[c]));
+                sum = _mm256_add_pd(sum, _mm256_mul_pd(diff, diff));
+            }
+            _mm256_storeu_pd(out + j, sum);
+        }
+        distanceSquaredScalar<double, double>(point, block, j, nblock, k, ld, out);
+    }
+
+    template <size_t K>
+    LHS_TARGET_AVX512
+    static void distanceSquaredAVX512(const int32_t * point, const int32_t * block, size_t nblock,
+        size_t k, size_t ld, uint32_t * out)
+    {
+        const size_t nk = (K > 0) ? K : k;
+        size_t j = 0;
+        for (; j + 16 <= nblock; j += 16)
+        {
+            __m512i sum = _mm512_setzero_si512();
+            LHS_UNROLL_K
+            for (size_t c = 0; c < nk; c++)
+            {
+                __m512i x = _mm512_loadu_si512(block + c * ld + j);
+                __m512i diff = _mm512_sub_epi32(x, _mm512_set1_epi32(point[c]));
+                sum = _mm512_add_epi32(sum, _mm512_mullo_epi32(diff, diff));
+            }
+            _mm512_storeu_si512(out + j, sum);
+        }
+        distanceSquaredScalar<int32_t, uint32_t>(point, block, j, nblock, k, ld, out);
+    }
+
+    template <size_t K>
+    LHS_TARGET_AVX512BW
+    static void distanceSquaredAVX512(const int16_t * point, const int16_t * block, size_t nblock,
+        size_t k, size_t ld, uint32_t * out)
+    {
+        const size_t nk = (K > 0) ? K : k;
+        const __m512i zero = _mm512_setzero_si512();
+        // the 64 bit halves of the 128 bit lanes of sumLo and sumHi in point order
+        const __m512i first = _mm512_set_epi64(11, 10, 3, 2, 9, 8, 1, 0);
+        const __m512i second = _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4);
+        size_t j = 0;
+        for (; j + 32 <= nblock; j += 32)
+        {
+            __m512i sumLo = _mm512_setzero_si512();
+            __m512i sumHi = _mm512_setzero_si512();
+            LHS_UNROLL_K
+            for (size_t c = 0; c < nk; c++)
+            {
+                __m512i diff = _mm512_sub_epi16(_mm512_loadu_si512(block + c * ld + j), _mm512_set1_epi16(point[c]));
+                __m512i lo = _mm512_unpacklo_epi16(diff, zero);
+                __m512i hi = _mm512_unpackhi_epi16(diff, zero);
+                sumLo = _mm512_add_epi32(sumLo, _mm512_madd_epi16(lo, lo));
+                sumHi = _mm512_add_epi32(sumHi, _mm512_madd_epi16(hi, hi));
+            }
+            _mm512_storeu_si512(out + j, _mm512_permutex2var_epi64(sumLo, first, sumHi));
+            _mm512_storeu_si512(out + j + 16, _mm512_permutex2var_epi64(sumLo, second, sumHi));
+        }
+        // fewer than 32 points are left, which the narrower kernels handle
+        distanceSquaredAVX2<K>(point, block + j, nblock - j, k, ld, out + j);
+    }
+
+    template <size_t K>
+    LHS_TARGET_AVX512
+    static void distanceSquaredAVX512(const double * point, const double * block, size_t nblock,
+        size_t k, size_t ld, double * out)
+    {
+        const size_t nk = (K > 0) ? K : k;
+        size_t j = 0;
+        for (; j + 8 <= nblock; j += 8)
+        {
+            __m512d sum = _mm512_setzero_pd();
+            LHS_UNROLL_K
+            for (size_t c = 0; c < nk; c++)
+            {
+                __m512d diff = _mm512_sub_pd(_mm512_loadu_pd(block + c * ld + j), _mm512_set1_pd(point[c]));
+                // AVX-512F has fused multiply-add, the explicit rounding forms keep the compiler from
+                // fusing and the zero-masked forms avoid an uninitialized register warning
+                __m512d square = _mm512_maskz_mul_round_pd(static_cast<__mmask8>(0xFF), diff, diff, _MM_FROUND_CUR_DIRECTION);
+                sum = _mm512_maskz_add_round_pd(static_cast<__mmask8>(0xFF), sum, square, _MM_FROUND_CUR_DIRECTION);
+            }
+            _mm512_storeu_pd(out + j, sum);
+        }
+        distanceSquaredScalar<double, double>(point, block, j, nblock, k, ld, out);
+    }
+
+    /// The SSE4.1 kernels, for <code>distanceSquaredFixedK</code>
+    struct KernelSSE41
+    {
+        template <size_t K, class T, class S>
+        static void run(const T * point, const T * block, size_t nblock, size_t k, size_t ld, S * out)
+        {
+            distanceSquaredSSE41<K>(point, block, nblock, k, ld, out);
+        }
+    };
+
+    /// The AVX2 kernels, for <code>distanceSquaredFixedK</code>
+    struct KernelAVX2
+    {
+        template <size_t K, class T, class S>
+        static void run(const T * point, const T * block, size_t nblock, size_t k, size_t ld, S * out)
+        {
+            distanceSquaredAVX2<K>(point, block, nblock, k, ld, out);
+        }
+    };
+
+    /// The AVX-512 kernels, for <code>distanceSquaredFixedK</code>
+    struct KernelAVX512
+    {
+        template <size_t K, class T, class S>
+        static void run(const T * point, const T * block, size_t nblock, size_t k, size_t ld, S * out)
+        {
+            distanceSquaredAVX512<K>(point, block, nblock, k, ld, out);
+        }
+    };
+
+    /**
+     * Call the kernel compiled for the number of coordinates.  Designs rarely
+     * have more than 16 variables, so each kernel is compiled for 1 to 16
+     * coordinates and a general version is used for more
+     * @param point the coordinates of the point
+     * @param block the first coordinate of the first point in the block
+     * @param nblock the number of points in the block
+     * @param k the number of coordinates
+     * @param ld the distance between coordinates of a point in the block
+     * @param out the squared distances
+     * @tparam Kernel the kernels of one instruction set
+     * @tparam T the type of the coordinates
+     * @tparam S the type of the squared distances
+     */
+    template <class Kernel, class T, class S>
+    static void distanceSquaredFixedK(const T * point, const T * block, size_t nblock,
+        size_t k, size_t ld, S * out)
+    {
+        switch (k)
+        {
+        case 1:
+            Kernel::template run<1>(point, block, nblock, k, ld, out);
+            return;
+        case 2:
+            Kernel::template run<2>(point, block, nblock, k, ld, out);
+            return;
+        case 3:
+            Kernel::template run<3>(point, block, nblock, k, ld, out);
+            return;
+        case 4:
+            Kernel::template run<4>(point, block, nblock, k, ld, out);
+            return;
+        case 5:
+            Kernel::template run<5>(point, block, nblock, k, ld, out);
+            return;
+        case 6:
+            Kernel::template run<6>(point, block, nblock, k, ld, out);
+            return;
+        case 7:
+            Kernel::template run<7>(point, block, nblock, k, ld, out);
+            return;
+        case 8:
+            Kernel::template run<8>(point, block, nblock, k, ld, out);
+            return;
+        case 9:
+            Kernel::template run<9>(point, block, nblock, k, ld, out);
+            return;
+        case 10:
+            Kernel::template run<10>(point, block, nblock, k, ld, out);
+            return;
+        case 11:
+            Kernel::template run<11>(point, block, nblock, k, ld, out);
+            return;
+        case 12:
+            Kernel::template run<12>(point, block, nblock, k, ld, out);
+            return;
+        case 13:
+            Kernel::template run<13>(point, block, nblock, k, ld, out);
+            return;
+        case 14:
+            Kernel::template run<14>(point, block, nblock, k, ld, out);
+            return;
+        case 15:
+            Kernel::template run<15>(point, block, nblock, k, ld, out);
+            return;
+        case 16:
+            Kernel::template run<16>(point, block, nblock, k, ld, out);
+            return;
+        default:
+            Kernel::template run<0>(point, block, nblock, k, ld, out);
+            return;
+        }
+    }
+#endif
+
+    /**
+     * The level used by the kernels, chosen on first use
+     * @return the level
+     */
+    static std::atomic<int> & activeLevel()
+    {
+        // function local statics are initialized once in a thread-safe way
+        static std::atomic<int> level(static_cast<int>(detectSimdLevel()));
+        return level;
+    }
+
+#ifdef LHS_SIMD_X86
+    /**
+     * Does the processor have the AVX-512 byte and word instructions
+     * @return true if AVX-512BW is supported
+     */
+    static bool hasAvx512BW()
+    {
+        static const bool supported = (__builtin_cpu_init(), __builtin_cpu_supports("avx512bw") != 0);
+        return supported;
+    }
+#endif
+
+    SimdLevel detectSimdLevel()
+    {
+#ifdef LHS_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return SIMD_AVX512;
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return SIMD_AVX2;
+        }
+        if (__builtin_cpu_supports("sse4.1"))
+        {
+            return SIMD_SSE41;
+        }
+#endif
+        return SIMD_SCALAR;
+    }
+
+    SimdLevel getSimdLevel()
+    {
+        return static_cast<SimdLevel>(activeLevel().load());
+    }
+
+    SimdLevel setSimdLevel(SimdLevel level)
+    {
+        SimdLevel supported = detectSimdLevel();
+        SimdLevel used = (level > supported || level < SIMD_SCALAR) ? supported : level;
+        activeLevel().store(static_cast<int>(used));
+        return used;
+    }
+
+    const char * simdLevelName(SimdLevel level)
+    {
+        switch (level)
+        {
+        case SIMD_SSE41:
+            return "sse4.1";
+        case SIMD_AVX2:
+            return "avx2";
+        case SIMD_AVX512:
+            return "avx512";
+        default:
+            return "scalar";
+        }
+    }
+
+    void distanceSquaredToBlock(const int32_t * point, const int32_t * block, size_t nblock,
+        size_t k, size_t ld, uint32_t * out)
+    {
+#ifdef LHS_SIMD_X86
+        switch (getSimdLevel())
+        {
+        case SIMD_AVX512:
+            distanceSquaredFixedK<KernelAVX512>(point, block, nblock, k, ld, out);
+            return;
+        case SIMD_AVX2:
+            distanceSquaredFixedK<KernelAVX2>(point, block, nblock, k, ld, out);
+            return;
+        case SIMD_SSE41:
+            distanceSquaredFixedK<KernelSSE41>(point, block, nblock, k, ld, out);
+            return;
+        default:
+            break;
+        }
+#endif
+        distanceSquaredScalar<int32_t, uint32_t>(point, block, 0, nblock, k, ld, out);
+    }
+
+    void distanceSquaredToBlock(const int16_t * point, const int16_t * block, size_t nblock,
+        size_t k, size_t ld, uint32_t * out)
+    {
+#ifdef LHS_SIMD_X86
+        switch (getSimdLevel())
+        {
+        case SIMD_AVX512:
+            // the 16 bit kernel also needs the AVX-512 byte and word instructions
+            if (hasAvx512BW())
+            {
+                distanceSquaredFixedK<KernelAVX512>(point, block, nblock, k, ld, out);
+                return;
+            }
+            distanceSquaredFixedK<KernelAVX2>(point, block, nblock, k, ld, out);
+            return;
+        case SIMD_AVX2:
+            distanceSquaredFixedK<KernelAVX2>(point, block, nblock, k, ld, out);
+            return;
+        case SIMD_SSE41:
+            distanceSquaredFixedK<KernelSSE41>(point, block, nblock, k, ld, out);
+            return;
+        default:
+            break;
+        }
+#endif
+        distanceSquaredScalar<int16_t, uint32_t>(point, block, 0, nblock, k, ld, out);
+    }
+
+    void distanceSquaredToBlock(const double * point, const double * block, size_t nblock,
+        size_t k, size_t ld, double * out)
+    {
+#ifdef LHS_SIMD_X86
+        switch (getSimdLevel())
+        {
+        case SIMD_AVX512:
+            distanceSquaredFixedK<KernelAVX512>(point, block, nblock, k, ld, out);
+            return;
+        case SIMD_AVX2:
+            distanceSquaredFixedK<KernelAVX2>(point, block, nblock, k, ld, out);
+            return;
+        case SIMD_SSE41:
+            distanceSquaredFixedK<KernelSSE41>(point, block, nblock, k, ld, out);
+            return;
+        default:
+            break;
+        }
+#endif
+        distanceSquaredScalar<double, double>(point, block, 0, nblock, k, ld, out);
+    }
+} // end namespace
@@ -0,0 +1,158 @@
+/**
+ * @file simdDistance.h
+ * @author Robert Carnell
+ * @copyright Copyright (c) 2026, Robert Carnell
+ *
+ * License <a href="http://www.gnu.org/licenses/lgpl.html">GNU Lesser General Public License (LGPL v3)</a>
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SIMDDISTANCE_H
+#define	SIMDDISTANCE_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lhslib
+{
+    /**
+     * The instruction sets available to the distance kernels, in increasing order
+     */
+    enum SimdLevel
+    {
+        SIMD_SCALAR = 0, /**< portable C++ */
+        SIMD_SSE41 = 1, /**< 128 bit SSE4.1 */
+        SIMD_AVX2 = 2, /**< 256 bit AVX2 */
+        SIMD_AVX512 = 3 /**< 512 bit AVX-512F */
+    };
+
+    /**
+     * The best instruction set supported by the processor and the compiler
+     * @return the level, <code>SIMD_SCALAR</code> on processors other than x86
+     */
+    SimdLevel detectSimdLevel();
+
+    /**
+     * The instruction set used by the distance kernels
+     * @return the level, initially <code>detectSimdLevel()</code>
+     */
+    SimdLevel getSimdLevel();
+
+    /**
+     * Choose the instruction set used by the distance kernels, for example to
+     * compare the kernels in tests and benchmarks
+     * @param level the requested level, lowered to <code>detectSimdLevel()</code> if it is not supported
+     * @return the level in use
+     */
+    SimdLevel setSimdLevel(SimdLevel level);
+
+    /**
+     * The name of an instruction set level
+     * @param level the level
+     * @return <code>scalar</code>, <code>sse4.1</code>, <code>avx2</code>, or <code>avx512</code>
+     */
+    const char * simdLevelName(SimdLevel level);
+
+    /**
+     * Squared distances from one point to a block of points
+     *
+     * The block is stored by column: coordinate <code>c</code> of point
+     * <code>j</code> is <code>block[c*ld + j]</code>, so each SIMD lane holds
+     * one point of the block and sums its squared differences in column order.
+     * Integer kernels give the same result on every instruction set, and the
+     * double kernels add the same terms in the same order as the scalar loop,
+     * so they are also bit-for-bit identical.  Integer squared distances are
+     * summed in <code>uint32_t</code>, where a sum larger than
+     * <code>UINT32_MAX</code> wraps as the unsigned sums of the original
+     * algorithms did, instead of the undefined overflow of a signed sum.  The
+     * SIMD kernels are compiled for each <code>k</code> from 1 to 16 with the
+     * loop over the coordinates unrolled.
+     *
+     * @param point the <code>k</code> coordinates of the point
+     * @param block the first coordinate of the first point in the block
+     * @param nblock the number of points in the block
+     * @param k the number of coordinates
+     * @param ld the distance between coordinates of a point in the block, at least <code>nblock</code>
+     * @param out the <code>nblock</code> squared distances
+     */
+    void distanceSquaredToBlock(const int32_t * point, const int32_t * block, size_t nblock,
+        size_t k, size_t ld, uint32_t * out);
+
+    /**
+     * Squared distances from one point to a block of points with 16 bit coordinates
+     *
+     * The differences between coordinates must fit in 16 bits, as they do for
+     * coordinates between 0 and 32767.  The squared differences are summed in
+     * 32 bits.
+     * @see distanceSquaredToBlock(const int32_t *, const int32_t *, size_t, size_t, size_t, uint32_t *)
+     *
+     * @param point the <code>k</code> coordinates of the point
+     * @param block the first coordinate of the first point in the block
+     * @param nblock the number of points in the block
+     * @param k the number of coordinates
+     * @param ld the distance between coordinates of a point in the block, at least <code>nblock</code>
+     * @param out the <code>nblock</code> squared distances
+     */
+    void distanceSquaredToBlock(const int16_t * point, const int16_t * block, size_t nblock,
+        size_t k, size_t ld, uint32_t * out);
+
+    /**
+     * Squared distances from one point to a block of points with double coordinates
+     * @see distanceSquaredToBlock(const int32_t *, const int32_t *, size_t, size_t, size_t, uint32_t *)
+     *
+     * @param point the <code>k</code> coordinates of the point
+     * @param block the first coordinate of the first point in the block
+     * @param nblock the number of points in the block
+     * @param k the number of coordinates
+     * @param ld the distance between coordinates of a point in the block, at least <code>nblock</code>
+     * @param out the <code>nblock</code> squared distances
+     */
+    void distanceSquaredToBlock(const double * point, const double * block, size_t nblock,
+        size_t k, size_t ld, double * out);
+
+    /**
+     * Squared distances from one point to a block of points for other types,
+     * always computed with portable C++
+     * @see distanceSquaredToBlock(const int32_t *, const int32_t *, size_t, size_t, size_t, uint32_t *)
+     *
+     * @param point the <code>k</code> coordinates of the point
+     * @param block the first coordinate of the first point in the block
+     * @param nblock the number of points in the block
+     * @param k the number of coordinates
+     * @param ld the distance between coordinates of a point in the block, at least <code>nblock</code>
+     * @param out the <code>nblock</code> squared distances
+     * @tparam T the type of the coordinates and distances
+     */
+    template <class T>
+    void distanceSquaredToBlock(const T * point, const T * block, size_t nblock,
+        size_t k, size_t ld, T * out)
+    {
+        // accumulate one coordinate at a time so the inner loop runs over contiguous points
+        for (size_t j = 0; j < nblock; j++)
+        {
+            out[j] = static_cast<T>(0);
+        }
+        for (size_t c = 0; c < k; c++)
+        {
+            const T * column = block + c * ld;
+            for (size_t j = 0; j < nblock; j++)
+            {
+                T diff = column[j] - point[c];
+                out[j] += diff * diff;
+            }
+        }
+    }
+} // end namespace
+
+#endif	/* SIMDDISTANCE_H */
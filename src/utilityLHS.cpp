@@ -67,18 +67,181 @@ namespace lhslib
         return ret;
     }
 
-    void initializeAvailableMatrix(bclib::matrix<int> & avail)
+    double PackedDistance::sumInverse() const
     {
-        // avail is k x n
-        for (msize_type irow = 0; irow < avail.rowsize(); irow++)
+        double total = 0.0;
+        for (std::vector<double>::const_iterator it = m_distance.begin(); it != m_distance.end(); ++it)
         {
-            for (msize_type jcol = 0; jcol < avail.colsize(); jcol++)
+            if (*it != 0.0)
             {
-                avail(irow, jcol) = static_cast<int>(jcol + 1);
+                total += 1.0 / *it;
             }
         }
+        return total;
     }
-    
+
+    double PackedDistance::minimum() const
+    {
+        if (m_distance.empty())
+        {
+            return 0.0;
+        }
+        return *std::min_element(m_distance.begin(), m_distance.end());
+    }
+
+    double PackedDistance::phiP(double p) const
+    {
+        if (p <= 0.0)
+        {
+            throw std::invalid_argument("p should be greater than 0");
+        }
+        double total = 0.0;
+        for (std::vector<double>::const_iterator it = m_distance.begin(); it != m_distance.end(); ++it)
+        {
+            if (*it != 0.0)
+            {
+                total += std::pow(*it, -p);
+            }
+        }
+        return std::pow(total, 1.0 / p);
+    }
+
+    InverseDistanceTable::InverseDistanceTable(int n, int k, double power)
+        : m_power(power)
+    {
+        if (n < 1 || k < 1)
+        {
+            throw std::invalid_argument("n and k should be integers greater than 0");
+        }
+        // the largest squared distance between rows of an integer hypercube on 1..n
+        double maxSquared = static_cast<double>(k) * static_cast<double>(n - 1) * static_cast<double>(n - 1);
+        size_t len = static_cast<size_t>(std::min(maxSquared + 1.0, static_cast<double>(LHS_DISTANCE_TABLE_MAX)));
+        m_table = std::vector<double>(len);
+        for (size_t d = 0; d < len; d++)
+        {
+            m_table[d] = term(static_cast<double>(d));
+        }
+    }
+
+    double InverseDistanceTable::term(double d) const
+    {
+        if (d == 0.0)
+        {
+            return 0.0;
+        }
+        // the inverse distance is computed as in sumInvDistance so that the terms agree exactly
+        if (m_power == 1.0)
+        {
+            return 1.0 / sqrt(d);
+        }
+        return std::pow(d, -0.5 * m_power);
+    }
+
+    /**
+     * Sum of the tabulated inverse distances between points, for use with <code>reduceAllPairs</code>
+     */
+    struct TableInverseDistanceSum
+    {
+        const InverseDistanceTable * table; /**< the inverse distance terms */
+        double total; /**< the sum of the inverse distances */
+
+        /**
+         * Constructor with a zero sum
+         * @param t the inverse distance terms
+         */
+        explicit TableInverseDistanceSum(const InverseDistanceTable & t) : table(&t), total(0.0) {}
+
+        /**
+         * Add the inverse of a block of distances
+         * @param distSquared the squared distances
+         * @param count the number of squared distances
+         */
+        void add(const uint32_t * distSquared, msize_type count)
+        {
+            for (msize_type j = 0; j < count; j++)
+            {
+                total += (*table)(distSquared[j]);
+            }
+        }
+
+        /**
+         * Add the inverse of a block of distances computed in double precision
+         * @param distSquared the squared distances, whole numbers
+         * @param count the number of squared distances
+         */
+        void add(const double * distSquared, msize_type count)
+        {
+            for (msize_type j = 0; j < count; j++)
+            {
+                total += (*table)(distSquared[j]);
+            }
+        }
+
+        /**
+         * Add the sum of another set of pairs
+         * @param other the sum to add
+         */
+        void merge(const TableInverseDistanceSum & other)
+        {
+            total += other.total;
+        }
+    };
+
+    /**
+     * Sum of the tabulated inverse distances between points stored one coordinate per row
+     * @param columns the <code>k x n</code> transpose of the points
+     * @param table the inverse distance terms for the integer squared distances
+     * @tparam T the integer type of the coordinates
+     * @return the sum of the inverse distances between points
+     */
+    template <class T>
+    static double sumInvDistanceColumns(const bclib::alignedMatrix<T> & columns, const InverseDistanceTable & table)
+    {
+        msize_type nr = columns.colsize();
+        msize_type nc = columns.rowsize();
+        std::vector<T> point(nc);
+        std::vector<uint32_t> distSquared(nr);
+        double totalInvDistance = 0.0;
+        for (msize_type irow = 0; irow + 1 < nr; irow++)
+        {
+            for (msize_type kcol = 0; kcol < nc; kcol++)
+            {
+                point[kcol] = columns(kcol, irow);
+            }
+            // the squared distances from irow to every later row
+            distanceSquaredToBlock(point.data(), columns.row(0) + irow + 1, nr - irow - 1, nc,
+                columns.leadingDimension(), distSquared.data());
+            for (msize_type j = 0; j < nr - irow - 1; j++)
+            {
+                totalInvDistance += table(distSquared[j]);
+            }
+        }
+        return totalInvDistance;
+    }
+
+    double sumInvDistance(const bclib::matrix<int> & A, const InverseDistanceTable & table)
+    {
+        if (A.rowsize() >= LHS_DISTANCE_BLOCKED_MIN_ROWS)
+        {
+            return reduceAllPairs(A, TableInverseDistanceSum(table)).total;
+        }
+        // hypercubes with fewer than 32768 rows are compared in 16 bit integers
+        if (isNarrowDesign(A))
+        {
+            bclib::alignedMatrix<int16_t> columns;
+            columns.assignTranspose(A);
+            return sumInvDistanceColumns(columns, table);
+        }
+        bclib::alignedMatrix<int> columns;
+        columns.assignTranspose(A);
+        return sumInvDistanceColumns(columns, table);
+    }
+
+    double calculateSOptimal(const bclib::matrix<int> & mat, const InverseDistanceTable & table)
+    {
+        return 1.0 / sumInvDistance(mat, table);
+    }
+
     void runif_std(unsigned int n, std::vector<double> & output, bclib::CRandom<double> & oRandom)
     {
         if (output.size() != n)
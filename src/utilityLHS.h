@@ -22,6 +22,9 @@
 #define	UTILITYLHS_H
 
 #include "LHSCommonDefines.h"
+#include "alignedMatrix.h"
+#include "simdDistance.h"
+#include "blockedDistance.h"
 
 namespace lhslib
 {
@@ -71,9 +74,54 @@ namespace lhslib
     
     /**
      * Initialize the matrix of available points
-     * @param avail the matrix of available points
+     * @param avail the <code>k x n</code> matrix of available points
+     * @tparam T the integer type of the matrix
      */
-    void initializeAvailableMatrix(bclib::matrix<int> & avail);
+    template <class T>
+    void initializeAvailableMatrix(bclib::matrix<T> & avail)
+    {
+        for (msize_type irow = 0; irow < avail.rowsize(); irow++)
+        {
+            for (msize_type jcol = 0; jcol < avail.colsize(); jcol++)
+            {
+                avail(irow, jcol) = static_cast<T>(jcol + 1);
+            }
+        }
+    }
+
+    /**
+     * Can a Latin hypercube with <code>n</code> rows be built in 16 bit integers.
+     * The values <code>1..n</code> and their differences fit in <code>int16_t</code>.
+     * The distance kernels sum the squared distances in <code>uint32_t</code>
+     * for both widths, so a sum over many columns that passes
+     * <code>UINT32_MAX</code> wraps the same way in either and the design does
+     * not depend on the width
+     * @param n the number of rows
+     * @return true if <code>n <= 32767</code>
+     */
+    inline bool isNarrowDesignSize(msize_type n)
+    {
+        return n <= static_cast<msize_type>(std::numeric_limits<int16_t>::max());
+    }
+
+    /**
+     * Copy an integer hypercube to a matrix with another integer type
+     * @param from the hypercube to copy
+     * @param to the matrix to copy into, the same size as <code>from</code>
+     * @tparam U the type of object in <code>from</code>
+     * @tparam T the type of object in <code>to</code>
+     */
+    template <class U, class T>
+    void convertDesign(const bclib::matrix<U> & from, bclib::matrix<T> & to)
+    {
+        for (msize_type irow = 0; irow < from.rowsize(); irow++)
+        {
+            for (msize_type jcol = 0; jcol < from.colsize(); jcol++)
+            {
+                to(irow, jcol) = static_cast<T>(from(irow, jcol));
+            }
+        }
+    }
 
     /**
      * print the Latin hypercube sample
@@ -171,19 +219,150 @@ namespace lhslib
         {
             result = bclib::matrix<double>(m_rows, m_rows);
         }
-        for (msize_type i = 0; i < m_rows - 1; i++)
+        // each row is compared to the block of rows after it with the SIMD kernels
+        bclib::alignedMatrix<T> columns;
+        columns.assignTranspose(mat);
+        msize_type k = columns.rowsize();
+        std::vector<T> point(k);
+        std::vector<typename squaredDistanceType<T>::type> distSquared(m_rows);
+        for (msize_type i = 0; i + 1 < m_rows; i++)
         {
+            for (msize_type c = 0; c < k; c++)
+            {
+                point[c] = columns(c, i);
+            }
+            distanceSquaredToBlock(point.data(), columns.row(0) + i + 1, m_rows - i - 1, k,
+                columns.leadingDimension(), distSquared.data());
             for (msize_type j = i+1; j < m_rows; j++)
             {
-                typename bclib::matrix<T>::const_rowwise_iterator rowi_begin = mat.rowwisebegin(i);
-                typename bclib::matrix<T>::const_rowwise_iterator rowi_end = mat.rowwiseend(i);
-                typename bclib::matrix<T>::const_rowwise_iterator rowj_begin = mat.rowwisebegin(j);
-                T sum = calculateDistanceSquared<T, true>(rowi_begin, rowi_end, rowj_begin);
-                result(i,j) = sqrt(static_cast<double>(sum));
+                result(i,j) = sqrt(static_cast<double>(distSquared[j - i - 1]));
             }
         }
     }
 
+    /**
+     * The distances between the rows of a matrix in packed upper triangular storage
+     *
+     * Only the <code>n(n-1)/2</code> distances between distinct rows are stored,
+     * row by row, so the criteria are reduced over the pairs directly without the
+     * zero diagonal and lower triangle of a full distance matrix.
+     */
+    class PackedDistance
+    {
+    public:
+        /** Default constructor with no rows */
+        PackedDistance() : m_n(0) {};
+
+        /**
+         * Constructor
+         * @param mat the matrix to calculate distances on
+         * @tparam T the type of object in the matrix
+         */
+        template <class T>
+        explicit PackedDistance(const bclib::matrix<T> & mat) : m_n(0)
+        {
+            calculate<T>(mat);
+        }
+
+        /**
+         * Calculate the distances between the rows of a matrix
+         * @param mat the matrix to calculate distances on
+         * @tparam T the type of object in the matrix
+         */
+        template <class T>
+        void calculate(const bclib::matrix<T> & mat)
+        {
+            bclib::alignedMatrix<T> columns;
+            columns.assignTranspose(mat);
+            calculateFromColumns<T>(columns);
+        }
+
+        /**
+         * Calculate the distances between points stored one coordinate per row,
+         * the transpose of the usual layout, so that each point is compared to
+         * the block of points after it with the SIMD kernels
+         * @param columns the <code>k x n</code> transpose of the points
+         * @tparam T the type of object in the matrix
+         */
+        template <class T>
+        void calculateFromColumns(const bclib::alignedMatrix<T> & columns)
+        {
+            m_n = columns.colsize();
+            msize_type k = columns.rowsize();
+            m_distance.resize((m_n < 2) ? 0 : m_n * (m_n - 1) / 2);
+            std::vector<T> point(k);
+            std::vector<typename squaredDistanceType<T>::type> distSquared(m_n);
+            std::vector<double>::iterator dit = m_distance.begin();
+            for (msize_type i = 0; i + 1 < m_n; i++)
+            {
+                for (msize_type c = 0; c < k; c++)
+                {
+                    point[c] = columns(c, i);
+                }
+                distanceSquaredToBlock(point.data(), columns.row(0) + i + 1, m_n - i - 1, k,
+                    columns.leadingDimension(), distSquared.data());
+                for (msize_type j = 0; j < m_n - i - 1; j++, ++dit)
+                {
+                    *dit = sqrt(static_cast<double>(distSquared[j]));
+                }
+            }
+        }
+
+        /**
+         * Get the number of rows in the matrix the distances were calculated on
+         * @return the number of rows
+         */
+        msize_type rowsize() const {return m_n;};
+
+        /**
+         * Get the number of stored distances
+         * @return <code>n(n-1)/2</code>
+         */
+        size_t size() const {return m_distance.size();};
+
+        /**
+         * The distance between two distinct rows
+         * @param i the first row
+         * @param j the second row, <code>j > i</code>
+         * @return the distance
+         */
+        double operator()(msize_type i, msize_type j) const
+        {
+            // the rows before i hold (n-1) + (n-2) + ... + (n-i) pairs
+            return m_distance[i * (2 * m_n - i - 1) / 2 + (j - i - 1)];
+        }
+
+        /**
+         * Get the packed distances
+         * @return the distances between rows ordered by the first and then the second row
+         */
+        const std::vector<double> & getDistances() const {return m_distance;};
+
+        /**
+         * Sum of the inverse distances between rows.  Zero distances are skipped
+         * @return the sum of the inverse distances
+         */
+        double sumInverse() const;
+
+        /**
+         * The minimum distance between rows
+         * @return the minimum distance, or 0 if there are fewer than two rows
+         */
+        double minimum() const;
+
+        /**
+         * The phi_p criterion of Morris and Mitchell <code>(sum d^-p)^(1/p)</code>.
+         * Zero distances are skipped
+         * @param p the power, <code>p > 0</code>
+         * @return the criterion
+         */
+        double phiP(double p) const;
+
+    private:
+        msize_type m_n; /**< the number of rows */
+        std::vector<double> m_distance; /**< the packed upper triangle of distances */
+    };
+
     /**
      * A function to invert a number in a STL algorithm
      * @tparam T the type of number to invert
@@ -211,7 +390,85 @@ namespace lhslib
     };
 
     /**
-     * sum of the inverse distance between points in a matrix
+     * Power law terms of the integer squared distances in a Latin hypercube
+     *
+     * When the hypercube holds the integers <code>1..n</code> in <code>k</code>
+     * columns, every squared distance between rows is an integer between 0 and
+     * <code>k(n-1)^2</code>, so the term <code>d^(-p/2)</code> is looked up
+     * instead of computed.  At most <code>LHS_DISTANCE_TABLE_MAX</code> terms
+     * are tabulated and larger squared distances are computed directly.  The
+     * zero distance maps to zero, matching <code>invert</code>.
+     */
+    class InverseDistanceTable
+    {
+    public:
+        /**
+         * Constructor
+         * @param n the number of rows in the hypercube
+         * @param k the number of columns in the hypercube
+         * @param power the power <code>p</code> applied to the distance.  <code>p = 1</code>
+         * gives the inverse distance
+         */
+        InverseDistanceTable(int n, int k, double power = 1.0);
+
+        /**
+         * The term for a squared distance
+         * @param d the squared distance
+         * @return <code>d^(-p/2)</code>, or 0 if <code>d = 0</code>
+         */
+        double operator()(unsigned int d) const
+        {
+            return (d < m_table.size()) ? m_table[d] : term(static_cast<double>(d));
+        }
+
+        /**
+         * The term for a squared distance too large for an unsigned integer
+         * @param d the squared distance, a whole number
+         * @return <code>d^(-p/2)</code>, or 0 if <code>d = 0</code>
+         */
+        double operator()(double d) const
+        {
+            return (d < static_cast<double>(m_table.size())) ? m_table[static_cast<size_t>(d)] : term(d);
+        }
+
+        /**
+         * Get the number of tabulated squared distances
+         * @return the size of the table
+         */
+        size_t size() const {return m_table.size();};
+
+        /**
+         * Get the power applied to the distance
+         * @return the power <code>p</code>
+         */
+        double getPower() const {return m_power;};
+
+    private:
+        /**
+         * Compute the term for a squared distance
+         * @param d the squared distance
+         * @return <code>d^(-p/2)</code>, or 0 if <code>d = 0</code>
+         */
+        double term(double d) const;
+
+        std::vector<double> m_table; /**< the terms indexed by squared distance */
+        double m_power; /**< the power applied to the distance */
+    };
+
+    /**
+     * sum of the inverse distance between points in an integer matrix.  Matrices
+     * with at least <code>LHS_DISTANCE_BLOCKED_MIN_ROWS</code> rows use the
+     * blocked all-pairs distances
+     * @param A the matrix
+     * @param table the inverse distance terms for the integer squared distances of A
+     * @return the sum of the inverse distance between points
+     */
+    double sumInvDistance(const bclib::matrix<int> & A, const InverseDistanceTable & table);
+
+    /**
+     * sum of the inverse distance between points in a matrix.  Matrices with at
+     * least <code>LHS_DISTANCE_BLOCKED_MIN_ROWS</code> rows use the blocked
+     * all-pairs distances instead of storing every distance
      * @param A the matrix
      * @tparam T the type of object contained in the matrix
      * @return the sum of the inverse distance between points
@@ -219,16 +476,27 @@ namespace lhslib
  	template <class T>
 	double sumInvDistance(const bclib::matrix<T> & A)
     {
-        // create a matrix to hold the distances
-        bclib::matrix<double> dist = bclib::matrix<double>(A.rowsize(), A.rowsize());
-        // calculate the distances between the rows of A
-        calculateDistance<T>(A, dist);
-        // invert all the distances
-        std::transform<bclib::matrix<double>::iterator>(dist.begin(), dist.end(), 
-                dist.begin(), invert<double, double>());
-        // sum the inverted 
-        double totalInvDistance = std::accumulate<bclib::matrix<double>::iterator>(dist.begin(), dist.end(), 0.0);
-		return totalInvDistance;
+        if (A.rowsize() >= LHS_DISTANCE_BLOCKED_MIN_ROWS)
+        {
+            return reduceAllPairs(A, InverseDistanceSum()).total;
+        }
+        // calculate the distances between the rows of A and sum their inverses
+        PackedDistance dist(A);
+        return dist.sumInverse();
+    }
+
+    /**
+     * The minimum distance between the rows of a matrix, computed with the
+     * blocked all-pairs distances without storing every distance
+     * @param A the matrix
+     * @tparam T the type of object contained in the matrix
+     * @return the minimum distance, or 0 if there are fewer than two rows
+     */
+    template <class T>
+    double minimumDistance(const bclib::matrix<T> & A)
+    {
+        MinimumDistanceSquared result = reduceAllPairs(A, MinimumDistanceSquared());
+        return (result.count == 0) ? 0.0 : sqrt(result.minimum);
     }
 
     /**
@@ -302,6 +570,14 @@ namespace lhslib
         return 1.0 / sum;
     }
 
+    /**
+     * Calculate the S optimality measure of an integer matrix
+     * @param mat the matrix to calculate S optimality for
+     * @param table the inverse distance terms for the integer squared distances of mat
+     * @return the S optimality measure
+     */
+    double calculateSOptimal(const bclib::matrix<int> & mat, const InverseDistanceTable & table);
+
     /**
      * Create a vector of random values on (0,1)
      * @param n the number of random values